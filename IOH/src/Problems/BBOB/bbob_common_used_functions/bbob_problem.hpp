@@ -0,0 +1,41 @@
+/// \file bbob_problem.hpp
+/// \brief Header file for class BBOB_problem.
+///
+/// \author Furong Ye
+#ifndef _BBOB_PROBLEM_HPP
+#define _BBOB_PROBLEM_HPP
+
+#include "IOHprofiler_problem.h"
+#include "coco_transformation.hpp"
+
+/// \brief A base class of the problems of the BBOB suite.
+///
+/// prepare_problem() of a BBOB problem stores the data of its instance in transformation_data,
+/// from which the COCO transformations of the problem are applied. The data belong to the
+/// problem, so several BBOB problems, or several threads evaluating the same problem, do
+/// not interfere.
+class BBOB_problem : public IOHprofiler_problem<double> {
+public:
+  BBOB_problem(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) :
+    IOHprofiler_problem<double>(instance_id, dimension) {}
+
+  ~BBOB_problem() {}
+
+  void internal_transform_variables(std::vector<double> &x) const {
+    coco_tranformation_vars(x,this->IOHprofiler_get_problem_id(),this->transformation_data);
+  }
+
+  void internal_transform_objectives(const std::vector<double> &x, std::vector<double> &y) const {
+    coco_tranformation_objs(x,y,this->IOHprofiler_get_problem_id(),this->transformation_data);
+  }
+
+  /// The COCO transformations and the optimum depend on the problem id.
+  void problem_id_changed() {
+    this->invalidate_instance();
+  }
+
+protected:
+  Coco_Transformation_Data transformation_data; /// < the data of the transformations of the instance.
+};
+
+#endif // _BBOB_PROBLEM_HPP
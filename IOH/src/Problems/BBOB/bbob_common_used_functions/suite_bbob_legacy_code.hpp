@@ -12,6 +12,7 @@
 #define _SUITE_BBOB_LEGACY_CODE_HPP
 
 #include "IOHprofiler_random.h"
+#include "IOHprofiler_instance_cache.h"
 
 static const double coco_pi = 3.14159265358979323846;
 /** @brief Maximal dimension used in BBOB2009. */
@@ -107,6 +108,8 @@ static void bbob2009_gauss(std::vector<double> &g, const size_t N, const long se
 
 /**
  * @brief Computes a DIM by DIM rotation matrix based on seed and stores it in B.
+ *
+ * The matrix is loaded from the instance cache if it was stored there, and stored otherwise.
  */
 static void bbob2009_compute_rotation(std::vector<std::vector<double> > &B, const long seed, const long DIM) {
   /* To ensure temporary data fits into gvec */
@@ -114,6 +117,16 @@ static void bbob2009_compute_rotation(std::vector<std::vector<double> > &B, cons
   std::vector<double> gvect(2000);
   long i, j, k; /* Loop over pairs of column vectors. */
 
+  std::ostringstream key;
+  key << "bbob_rotation_" << seed << "_" << DIM;
+  if (IOHprofiler_instance_cache::load(key.str(), gvect) && gvect.size() == (size_t) (DIM * DIM)) {
+    B = std::vector<std::vector<double> > (DIM);
+    for (i = 0; i < DIM; i++) {
+      B[i] = std::vector<double> (gvect.begin() + i * DIM, gvect.begin() + (i + 1) * DIM);
+    }
+    return;
+  }
+
   bbob2009_gauss(gvect, DIM * DIM, seed);
   bbob2009_reshape(B, gvect, DIM, DIM);
   /*1st coordinate is row, 2nd is column.*/
@@ -133,6 +146,13 @@ static void bbob2009_compute_rotation(std::vector<std::vector<double> > &B, cons
       B[k][i] /= sqrt(prod);
   }
 
+  if (!IOHprofiler_instance_cache::get_directory().empty()) {
+    gvect.clear();
+    for (i = 0; i < DIM; i++) {
+      gvect.insert(gvect.end(), B[i].begin(), B[i].end());
+    }
+    IOHprofiler_instance_cache::store(key.str(), gvect);
+  }
 }
 
 static void bbob2009_copy_rotation_matrix(const std::vector<std::vector<double> > &rot, std::vector<std::vector<double> > &M, std::vector<double> &b, const size_t DIM) {
@@ -9,10 +9,9 @@
 #ifndef _F_ATTRACTIVE_SECTOR_HPP
 #define _F_ATTRACTIVE_SECTOR_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Attractive_Sector : public IOHprofiler_problem<double> {
+class Attractive_Sector : public BBOB_problem {
 public:
   Attractive_Sector(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -61,10 +60,10 @@ public:
       }
     }
     
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
@@ -73,7 +72,7 @@ public:
     size_t n = x.size();
     
     for (size_t i = 0; i < n; ++i) {
-      if (Coco_Transformation_Data::xopt[i] * x[i] > 0.0) {
+      if (this->transformation_data.xopt[i] * x[i] > 0.0) {
         result[0] += 100.0 * 100.0 * x[i] * x[i];
       } else {
         result[0] += x[i] * x[i];
@@ -8,10 +8,9 @@
 #ifndef _F_BUECHE_RASTRIGIN_H
 #define _F_BUECHE_RASTRIGIN_H
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Bueche_Rastrigin : public IOHprofiler_problem<double> {
+class Bueche_Rastrigin : public BBOB_problem {
 public:
   Bueche_Rastrigin(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -41,11 +40,11 @@ public:
       xopt[i] = fabs(xopt[i]);
     }
 
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::penalty_factor = 100.0;
-    Coco_Transformation_Data::lower_bound = -5.0;
-    Coco_Transformation_Data::upper_bound = 5.0;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.penalty_factor = 100.0;
+    this->transformation_data.lower_bound = -5.0;
+    this->transformation_data.upper_bound = 5.0;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
@@ -8,10 +8,9 @@
 #ifndef _F_DIFFERENT_POWERS_HPP
 #define _F_DIFFERENT_POWERS_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Different_Powers : public IOHprofiler_problem<double> {
+class Different_Powers : public BBOB_problem {
 public:
   Different_Powers(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -50,10 +49,10 @@ public:
     bbob2009_compute_rotation(rot1, rseed + 1000000, n);
     bbob2009_copy_rotation_matrix(rot1,M,b,n);
     
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
@@ -9,10 +9,9 @@
 #ifndef _F_DISCUS_H
 #define _F_DISCUS_H
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Discus : public IOHprofiler_problem<double> {
+class Discus : public BBOB_problem {
 public:
   Discus(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -51,10 +50,10 @@ public:
     bbob2009_compute_rotation(rot1, rseed + 1000000, n);
     bbob2009_copy_rotation_matrix(rot1,M,b,n);
     
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
@@ -9,10 +9,9 @@
 #ifndef _F_ELLIPSOID_H
 #define _F_ELLIPSOID_H
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Ellipsoid : public IOHprofiler_problem<double> {
+class Ellipsoid : public BBOB_problem {
 public:
   Ellipsoid(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -39,8 +38,8 @@ public:
     bbob2009_compute_xopt(xopt, rseed, n);
     fopt = bbob2009_compute_fopt(2, this->IOHprofiler_get_instance_id());
 
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
   }
 
 
@@ -9,8 +9,7 @@
 #ifndef _F_GALLAGHERONEZEROONE_H
 #define _F_GALLAGHERONEZEROONE_H
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
 typedef struct f_gallagher_permutation_t1{
   double value;
@@ -36,7 +35,7 @@ static int f_gallagher_compare_doubles1(const void *a, const void *b) {
 }
 
 
-class Gallagher101 : public IOHprofiler_problem<double> {
+class Gallagher101 : public BBOB_problem {
 public:
   Gallagher101(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -89,7 +88,7 @@ public:
     }
 
     /* Allocate temporary storage and space for the rotation matrices */
-    std::vector<double >xopt = std::vector<double>(n);
+    xopt = std::vector<double>(n);
     
     maxcondition1 = sqrt(maxcondition1);
     b = 10.;
@@ -97,65 +96,109 @@ public:
 
     bbob2009_compute_rotation(rotation, rseed, n);
 
-    /* Initialize all the data of the inner problem */
-    bbob2009_unif(random_numbers, number_of_peaks - 1, rseed);
-    //rperm = std::vector<f_gallagher_permutation_t1> (number_of_peaks - 1);
-    rperm = (f_gallagher_permutation_t1 *)malloc((number_of_peaks-1) * sizeof(f_gallagher_permutation_t1));
-    for (i = 0; i < number_of_peaks - 1; ++i) {
-      rperm[i].value = random_numbers[i];
-      rperm[i].index = i;
-    }
-    //std::sort(rperm.begin(), rperm.end(), compareRperm);
-    qsort(rperm, number_of_peaks - 1, sizeof(f_gallagher_permutation_t1), f_gallagher_compare_doubles1);
-
-    /* Random permutation */
-    arrCondition = std::vector<double>(number_of_peaks);
-    arrCondition[0] = maxcondition1;
-    peak_values = std::vector<double>(number_of_peaks);
-    peak_values[0] = 10;
-    for (i = 1; i < number_of_peaks; ++i) {
-      arrCondition[i] = pow(maxcondition, (double) (rperm[i - 1].index) / ((double) (number_of_peaks - 2)));
-      peak_values[i] = (double) (i - 1) / (double) (number_of_peaks - 2) * (fitvalues[1] - fitvalues[0])
-          + fitvalues[0];
-    }
-
-    free(rperm);
-    rperm = (f_gallagher_permutation_t1 *)malloc((n) * sizeof(f_gallagher_permutation_t1));
-   
-    //rperm = std::vector<f_gallagher_permutation_t1> (n);
-    for (i = 0; i < number_of_peaks; ++i) {
-      bbob2009_unif(random_numbers, n, rseed + (long) (1000 * i));
-      for (j = 0; j < n; ++j) {
-        rperm[j].value = random_numbers[j];
-        rperm[j].index = j;
+    /* The peaks only depend on the seed and the dimension, and are taken from the instance cache if possible */
+    std::ostringstream key;
+    key << "bbob_gallagher" << number_of_peaks << "_" << rseed << "_" << n;
+    if (!load_peaks(key.str(), n)) {
+      /* Initialize all the data of the inner problem */
+      bbob2009_unif(random_numbers, number_of_peaks - 1, rseed);
+      //rperm = std::vector<f_gallagher_permutation_t1> (number_of_peaks - 1);
+      rperm = (f_gallagher_permutation_t1 *)malloc((number_of_peaks-1) * sizeof(f_gallagher_permutation_t1));
+      for (i = 0; i < number_of_peaks - 1; ++i) {
+        rperm[i].value = random_numbers[i];
+        rperm[i].index = i;
       }
       //std::sort(rperm.begin(), rperm.end(), compareRperm);
-      qsort(rperm, n, sizeof(f_gallagher_permutation_t1), f_gallagher_compare_doubles1);
-      for (j = 0; j < n; ++j) {
-        arr_scales[i][j] = pow(arrCondition[i],                             /* Lambda^alpha_i from the doc */
-            ((double) rperm[j].index) / ((double) (n - 1)) - 0.5);
+      qsort(rperm, number_of_peaks - 1, sizeof(f_gallagher_permutation_t1), f_gallagher_compare_doubles1);
+
+      /* Random permutation */
+      arrCondition = std::vector<double>(number_of_peaks);
+      arrCondition[0] = maxcondition1;
+      peak_values = std::vector<double>(number_of_peaks);
+      peak_values[0] = 10;
+      for (i = 1; i < number_of_peaks; ++i) {
+        arrCondition[i] = pow(maxcondition, (double) (rperm[i - 1].index) / ((double) (number_of_peaks - 2)));
+        peak_values[i] = (double) (i - 1) / (double) (number_of_peaks - 2) * (fitvalues[1] - fitvalues[0])
+            + fitvalues[0];
       }
-    }
-    free(rperm);
-    bbob2009_unif(random_numbers, n * number_of_peaks, rseed);
-    std::vector<double> best_variables(n);
-    for (i = 0; i < n; ++i) {
-      xopt[i] = 0.8 * (b * random_numbers[i] - c);
-      best_variables[i] = 0.8 * (b * random_numbers[i] - c);
-      for (j = 0; j < number_of_peaks; ++j) {
-        x_local[i][j] = 0.;
-        for (k = 0; k < n; ++k) {
-          x_local[i][j] += rotation[i][k] * (b * random_numbers[j * n + k] - c);
+
+      free(rperm);
+      rperm = (f_gallagher_permutation_t1 *)malloc((n) * sizeof(f_gallagher_permutation_t1));
+   
+      //rperm = std::vector<f_gallagher_permutation_t1> (n);
+      for (i = 0; i < number_of_peaks; ++i) {
+        bbob2009_unif(random_numbers, n, rseed + (long) (1000 * i));
+        for (j = 0; j < n; ++j) {
+          rperm[j].value = random_numbers[j];
+          rperm[j].index = j;
+        }
+        //std::sort(rperm.begin(), rperm.end(), compareRperm);
+        qsort(rperm, n, sizeof(f_gallagher_permutation_t1), f_gallagher_compare_doubles1);
+        for (j = 0; j < n; ++j) {
+          arr_scales[i][j] = pow(arrCondition[i],                             /* Lambda^alpha_i from the doc */
+              ((double) rperm[j].index) / ((double) (n - 1)) - 0.5);
         }
-        if (j == 0) {
-          x_local[i][j] *= 0.8;
+      }
+      free(rperm);
+      bbob2009_unif(random_numbers, n * number_of_peaks, rseed);
+      for (i = 0; i < n; ++i) {
+        xopt[i] = 0.8 * (b * random_numbers[i] - c);
+        for (j = 0; j < number_of_peaks; ++j) {
+          x_local[i][j] = 0.;
+          for (k = 0; k < n; ++k) {
+            x_local[i][j] += rotation[i][k] * (b * random_numbers[j * n + k] - c);
+          }
+          if (j == 0) {
+            x_local[i][j] *= 0.8;
+          }
         }
       }
+      store_peaks(key.str());
     }
-    IOHprofiler_set_best_variables(best_variables);
+    IOHprofiler_set_best_variables(xopt);
      
     fopt = bbob2009_compute_fopt(21, this->IOHprofiler_get_instance_id());
-    Coco_Transformation_Data::fopt = fopt;
+    this->transformation_data.fopt = fopt;
+  }
+
+  /// \fn bool load_peaks(const std::string &key, const size_t n)
+  ///
+  /// Loads xopt, the peak values, the scales and the local optima from the instance cache.
+  bool load_peaks(const std::string &key, const size_t n) {
+    std::vector<double> data;
+    if (!IOHprofiler_instance_cache::load(key, data) || data.size() != n + number_of_peaks * (2 * n + 1)) {
+      return false;
+    }
+    std::vector<double>::const_iterator value = data.begin();
+    xopt.assign(value, value + n);
+    value += n;
+    peak_values.assign(value, value + number_of_peaks);
+    value += number_of_peaks;
+    for (size_t i = 0; i != number_of_peaks; ++i, value += n) {
+      arr_scales[i].assign(value, value + n);
+    }
+    for (size_t i = 0; i != n; ++i, value += number_of_peaks) {
+      x_local[i].assign(value, value + number_of_peaks);
+    }
+    return true;
+  }
+
+  /// \fn void store_peaks(const std::string &key)
+  ///
+  /// Stores the data loaded by load_peaks() in the instance cache.
+  void store_peaks(const std::string &key) {
+    if (IOHprofiler_instance_cache::get_directory().empty()) {
+      return;
+    }
+    std::vector<double> data(xopt);
+    data.insert(data.end(), peak_values.begin(), peak_values.end());
+    for (size_t i = 0; i != arr_scales.size(); ++i) {
+      data.insert(data.end(), arr_scales[i].begin(), arr_scales[i].end());
+    }
+    for (size_t i = 0; i != x_local.size(); ++i) {
+      data.insert(data.end(), x_local[i].begin(), x_local[i].end());
+    }
+    IOHprofiler_instance_cache::store(key, data);
   }
 
   double internal_evaluate(const std::vector<double> &x) {
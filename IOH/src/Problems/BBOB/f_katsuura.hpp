@@ -9,10 +9,9 @@
 #ifndef _F_KATSUURA_H
 #define _F_KATSUURA_H
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Katsuura : public IOHprofiler_problem<double> {
+class Katsuura : public BBOB_problem {
 public:
   Katsuura(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -61,11 +60,11 @@ public:
         }
       }
     }
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
-    Coco_Transformation_Data::penalty_factor = penalty_factor;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
+    this->transformation_data.penalty_factor = penalty_factor;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
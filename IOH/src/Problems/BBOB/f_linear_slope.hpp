@@ -9,10 +9,9 @@
 #ifndef _F_LINEAR_SLOPE_H
 #define _F_LINEAR_SLOPE_H
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Linear_Slope : public IOHprofiler_problem<double> {
+class Linear_Slope : public BBOB_problem {
 public:
   Linear_Slope(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -39,8 +38,8 @@ public:
     bbob2009_compute_xopt(xopt, rseed, n);
     fopt = bbob2009_compute_fopt(5, this->IOHprofiler_get_instance_id());
 
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
 
     std::vector<double> tmp_best_variables = std::vector<double>(n);
     for (int i = 0; i < n; ++i) {
@@ -64,16 +63,16 @@ public:
 
       base = sqrt(alpha);
       exponent = (double) (long) i / ((double) (long) n - 1);
-      if (Coco_Transformation_Data::xopt[i] > 0.0) {
+      if (this->transformation_data.xopt[i] > 0.0) {
         si = pow(base, exponent);
       } else {
         si = -pow(base, exponent);
       }
       /* boundary handling */
-      if (x[i] * Coco_Transformation_Data::xopt[i] < 25.0) {
+      if (x[i] * this->transformation_data.xopt[i] < 25.0) {
         result[0] += 5.0 * fabs(si) - si * x[i];
       } else {
-        result[0] += 5.0 * fabs(si) - si * Coco_Transformation_Data::xopt[i];
+        result[0] += 5.0 * fabs(si) - si * this->transformation_data.xopt[i];
       }
     }
 
@@ -9,10 +9,9 @@
 #ifndef _F_LUNACEK_BI_RASTRIGIN_HPP
 #define _F_LUNACEK_BI_RASTRIGIN_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Lunacek_Bi_Rastrigin : public IOHprofiler_problem<double> {
+class Lunacek_Bi_Rastrigin : public BBOB_problem {
 public:
   Lunacek_Bi_Rastrigin(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -45,10 +44,10 @@ public:
     bbob2009_compute_rotation(rot1, rseed + 1000000, n);
     bbob2009_compute_rotation(rot2, rseed, n);
 
-    Coco_Transformation_Data::fopt = fopt;
+    this->transformation_data.fopt = fopt;
 
-    Coco_Transformation_Data::rot1 = rot1;
-    Coco_Transformation_Data::rot2 = rot2;
+    this->transformation_data.rot1 = rot1;
+    this->transformation_data.rot2 = rot2;
 
   
     bbob2009_gauss(tmpvect, n, rseed);
@@ -58,7 +57,7 @@ public:
         xopt[i] *= -1.0;
       }
     }
-    Coco_Transformation_Data::xopt = xopt;
+    this->transformation_data.xopt = xopt;
     IOHprofiler_set_best_variables(xopt);
   }
 
@@ -87,7 +86,7 @@ public:
     /* x_hat */
     for (i = 0; i < n; ++i) {
       x_hat[i] = 2. * x[i];
-      if (Coco_Transformation_Data::xopt[i] < 0.) {
+      if (this->transformation_data.xopt[i] < 0.) {
         x_hat[i] *= -1.;
       }
     }
@@ -97,13 +96,13 @@ public:
       tmpvect[i] = 0.0;
       c1 = pow(sqrt(condition), ((double) i) / (double) (n - 1));
       for (j = 0; j < n; ++j) {
-        tmpvect[i] += c1 * Coco_Transformation_Data::rot2[i][j] * (x_hat[j] - mu0);
+        tmpvect[i] += c1 * this->transformation_data.rot2[i][j] * (x_hat[j] - mu0);
       }
     }
     for (i = 0; i < n; ++i) {
       z[i] = 0;
       for (j = 0; j < n; ++j) {
-        z[i] += Coco_Transformation_Data::rot1[i][j] * tmpvect[j];
+        z[i] += this->transformation_data.rot1[i][j] * tmpvect[j];
       }
     }
     /* Computation core */
@@ -9,10 +9,9 @@
 #ifndef _F_ROSENBROCK_HPP
 #define _F_ROSENBROCK_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Rosenbrock : public IOHprofiler_problem<double> {
+class Rosenbrock : public BBOB_problem {
 public:
   Rosenbrock(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -46,10 +45,10 @@ public:
     }
 
     factor = 1.0 > (sqrt((double) n) / 8.0) ? 1 : (sqrt((double) n) / 8.0);
-    Coco_Transformation_Data::minus_one = minus_one;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::factor = factor;
-    Coco_Transformation_Data::fopt = fopt;
+    this->transformation_data.minus_one = minus_one;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.factor = factor;
+    this->transformation_data.fopt = fopt;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
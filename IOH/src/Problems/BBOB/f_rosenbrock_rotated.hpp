@@ -9,10 +9,9 @@
 #ifndef _F_ROSENBROCK_ROTATED_HPP
 #define _F_ROSENBROCK_ROTATED_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Rosenbrock_Rotated : public IOHprofiler_problem<double> {
+class Rosenbrock_Rotated : public BBOB_problem {
 public:
   Rosenbrock_Rotated(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -65,10 +64,10 @@ public:
     // }
     // IOHprofiler_set_best_variables(tmp_best_variables);
 
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::factor = factor;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.factor = factor;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
     
   }
 
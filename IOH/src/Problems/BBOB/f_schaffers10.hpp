@@ -9,10 +9,9 @@
 #ifndef _F_SCHAFFERSTEN_HPP
 #define _F_SCHAFFERSTEN_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Schaffers10 : public IOHprofiler_problem<double> {
+class Schaffers10 : public BBOB_problem {
 public:
   Schaffers10(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -67,13 +66,13 @@ public:
     }
     bbob2009_copy_rotation_matrix(rot1,M1,b1,n);
 
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
-    Coco_Transformation_Data::M1 = M1;
-    Coco_Transformation_Data::b1 = b1;
-    Coco_Transformation_Data::penalty_factor = 10.0;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
+    this->transformation_data.M1 = M1;
+    this->transformation_data.b1 = b1;
+    this->transformation_data.penalty_factor = 10.0;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
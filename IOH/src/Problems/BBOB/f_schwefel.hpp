@@ -9,10 +9,9 @@
 #ifndef _F_SCHWEFEL_HPP
 #define _F_SCHWEFEL_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Schwefel : public IOHprofiler_problem<double> {
+class Schwefel : public BBOB_problem {
 public:
   Schwefel(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -48,12 +47,12 @@ public:
       tmp2[i] = 2 * fabs(xopt[i]);
     }
     
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::tmp1 = tmp1;
-    Coco_Transformation_Data::tmp2 = tmp2;
-    Coco_Transformation_Data::condition = 10.0;
-    Coco_Transformation_Data::rseed = rseed;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.tmp1 = tmp1;
+    this->transformation_data.tmp2 = tmp2;
+    this->transformation_data.condition = 10.0;
+    this->transformation_data.rseed = rseed;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
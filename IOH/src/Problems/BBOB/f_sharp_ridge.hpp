@@ -9,10 +9,9 @@
 #ifndef _F_SHARP_RIDGE_HPP
 #define _F_SHARP_RIDGE_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Sharp_Ridge : public IOHprofiler_problem<double> {
+class Sharp_Ridge : public BBOB_problem {
 public:
   Sharp_Ridge(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -61,10 +60,10 @@ public:
         }
       }
     }
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
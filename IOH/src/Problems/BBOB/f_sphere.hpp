@@ -9,10 +9,9 @@
 #ifndef _F_SPHERE_HPP_
 #define _F_SPHERE_HPP_
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
-class Sphere : public IOHprofiler_problem<double> {
+class Sphere : public BBOB_problem {
 public:
   Sphere(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -38,8 +37,8 @@ public:
     bbob2009_compute_xopt(xopt, rseed, n);
     fopt = bbob2009_compute_fopt(1, this->IOHprofiler_get_instance_id());
 
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
@@ -9,11 +9,10 @@
 #ifndef _F_STEP_ELLIPSOID_HPP
 #define _F_STEP_ELLIPSOID_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 #include <math.h>
 
-class Step_Ellipsoid : public IOHprofiler_problem<double> {
+class Step_Ellipsoid : public BBOB_problem {
 public:
   Step_Ellipsoid(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -34,7 +33,6 @@ public:
   double fopt;
   std::vector<std::vector<double> > rot1;
   std::vector<std::vector<double> > rot2;
-  std::vector<double> datax,dataxx;
   
   void prepare_problem() {
     /* compute xopt, fopt*/
@@ -48,9 +46,6 @@ public:
     bbob2009_compute_rotation(rot1, rseed + 1000000, n);
     bbob2009_compute_rotation(rot2, rseed, n);
 
-    datax = std::vector<double>(n);
-    dataxx = std::vector<double>(n);
-
     IOHprofiler_set_best_variables(xopt);
   }
 
@@ -61,6 +56,10 @@ public:
     size_t i, j;
     double penalty = 0.0, x1;
     std::vector<double> result(1);
+    /// the buffers are per thread, so that the problem can be evaluated by several threads.
+    static thread_local std::vector<double> datax, dataxx;
+    datax.resize(n);
+    dataxx.resize(n);
 
     for (i = 0; i < n; ++i) {
       double tmp;
@@ -8,13 +8,12 @@
 #ifndef _F_WEIERSTRASS_HPP
 #define _F_WEIERSTRASS_HPP
 
-#include "IOHprofiler_problem.h"
-#include "coco_transformation.hpp"
+#include "bbob_problem.hpp"
 
 /** @brief Number of summands in the Weierstrass problem. */
 #define F_WEIERSTRASS_SUMMANDS 12
 
-class Weierstrass : public IOHprofiler_problem<double> {
+class Weierstrass : public BBOB_problem {
 public:
   Weierstrass(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     IOHprofiler_set_instance_id(instance_id);
@@ -83,13 +82,13 @@ public:
       bk[i] = pow(3., (double) i);
       f0 += ak[i] * cos(2 * coco_pi * bk[i] * 0.5);
     }
-    Coco_Transformation_Data::fopt = fopt;
-    Coco_Transformation_Data::xopt = xopt;
-    Coco_Transformation_Data::M = M;
-    Coco_Transformation_Data::b = b;
-    Coco_Transformation_Data::M1 = M1;
-    Coco_Transformation_Data::b1 = b1;
-    Coco_Transformation_Data::penalty_factor = 10.0 / (double) n;
+    this->transformation_data.fopt = fopt;
+    this->transformation_data.xopt = xopt;
+    this->transformation_data.M = M;
+    this->transformation_data.b = b;
+    this->transformation_data.M1 = M1;
+    this->transformation_data.b1 = b1;
+    this->transformation_data.penalty_factor = 10.0 / (double) n;
   }
 
   double internal_evaluate(const std::vector<double> &x) {
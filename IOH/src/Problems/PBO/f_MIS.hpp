@@ -37,40 +37,87 @@ public:
   }
 
 
-double internal_evaluate(const std::vector<int> &x) {
-    int i, j,index;
-    int n = x.size();
+  /// \fn void prepare_problem()
+  ///
+  /// Lists the edges of the graph on the first n - n % 2 variables (isEdge on the
+  /// vertices 1, 2, ...) and the neighbours of each vertex.
+  void prepare_problem() {
+    int n = IOHprofiler_get_number_of_variables();
+    int number_of_variables_even = n - n % 2;
+    this->graph_size = number_of_variables_even;
+    this->edge_sources.clear();
+    this->edge_targets.clear();
+    std::vector<std::vector<int> > neighbors(number_of_variables_even);
+    for (int i = 1; i <= number_of_variables_even; ++i) {
+      const int candidates[3] = {i + 1, i + number_of_variables_even / 2 + 1, i + number_of_variables_even / 2 - 1};
+      for (int c = 0; c != 3; ++c) {
+        const int j = candidates[c];
+        if (j <= i || j > number_of_variables_even || (c == 2 && j == candidates[0])) {
+          continue;
+        }
+        if (isEdge(i,j,(size_t)number_of_variables_even) == 1) {
+          this->edge_sources.push_back(i - 1);
+          this->edge_targets.push_back(j - 1);
+          neighbors[i - 1].push_back(j - 1);
+          neighbors[j - 1].push_back(i - 1);
+        }
+      }
+    }
+
+    this->neighbor_offsets.assign(1,0);
+    this->neighbor_indices.clear();
+    for (int i = 0; i != number_of_variables_even; ++i) {
+      this->neighbor_indices.insert(this->neighbor_indices.end(),neighbors[i].begin(),neighbors[i].end());
+      this->neighbor_offsets.push_back((int)this->neighbor_indices.size());
+    }
+  }
+
+  double internal_evaluate(const std::vector<int> &x) {
+    int number_of_variables_even = std::min((int)x.size(),this->graph_size);
     int result= 0;
     int num_of_ones=0;
     int sum_edges_in_the_set=0;
-    int number_of_variables_even=(int)n;
-    std::vector<int> ones_array(number_of_variables_even+1);
-  
-    if (n%2!=0) {
-        number_of_variables_even=(int)n-1;
-    }
-   
-    for (index=0; index<number_of_variables_even; index++) {
-      if (x[index]==1) {
-        ones_array[num_of_ones] = index;
-        num_of_ones+=1;
-      }
+
+    for (int index=0; index<number_of_variables_even; index++) {
+      num_of_ones += (x[index]==1);
     }
 
-    for (i=0; i<num_of_ones; i++) {
-      for (j=i+1; j<num_of_ones; j++) {
-        if (isEdge(ones_array[i]+1,ones_array[j]+1,(size_t)number_of_variables_even)==1) {
-          sum_edges_in_the_set+=1;
-        }
-      }
+    const std::size_t number_of_edges = this->edge_sources.size();
+    for (std::size_t e = 0; e != number_of_edges; ++e) {
+      sum_edges_in_the_set += (x[this->edge_sources[e]]==1 && x[this->edge_targets[e]]==1);
     }
     result=num_of_ones - (number_of_variables_even*sum_edges_in_the_set);
     return (double)result;
   }
 
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// Flipping x[i] changes the number of ones by one, and the number of edges in the set
+  /// by the number of selected neighbours of i.
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    if ((int)i >= this->graph_size) {
+      return raw_objective;
+    }
+    int selected_neighbors = 0;
+    for (int d = this->neighbor_offsets[i]; d != this->neighbor_offsets[i + 1]; ++d) {
+      selected_neighbors += (x[this->neighbor_indices[d]]==1);
+    }
+    const int change = 1 - this->graph_size * selected_neighbors;
+    return x[i]==1 ? raw_objective - (double)change : raw_objective + (double)change;
+  }
+
   static MIS * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new MIS(instance_id, dimension);
   }
+
+private:
+  int graph_size = 0; /// < the number of vertices, i.e., n - n % 2.
+  std::vector<int> edge_sources; /// < the edges, as 0-based vertices.
+  std::vector<int> edge_targets;
+  std::vector<int> neighbor_offsets; /// < the neighbours of vertex i are at [neighbor_offsets[i], neighbor_offsets[i + 1]).
+  std::vector<int> neighbor_indices;
 };
 
 #endif
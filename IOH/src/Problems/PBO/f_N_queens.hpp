@@ -36,77 +36,114 @@ public:
     }
   }
 
+  void prepare_problem() {
+    int n = IOHprofiler_get_number_of_variables();
+    this->square_board = (floor(sqrt((double)n)) == sqrt((double)n));
+    this->board_size = (int)(sqrt((double)n)+0.5);
+  }
+
+  /// The penalty of a row, a column or a diagonal with c queens is max(0, c - 1). The
+  /// queens are counted per line in one pass over the board, the diagonals with a single
+  /// square, which never have a penalty, included.
   double internal_evaluate(const std::vector<int> &x) {
-    
-    double result;
-    int n = x.size();
-    int index,j,i,k,l;
-    int N_queens=(int)(sqrt((double)n)+0.5);
+    int N_queens = this->board_size;
     int number_of_queens_on_board = 0;
-    double k_penalty=0.0;
-    double l_penalty =0.0;
-    double raws_penalty=0.0;
-    double columns_penalty=0.0;
-    int indx=0;
-    float C = (float)N_queens;
-
-    if (floor(sqrt((double)n))!=sqrt((double)n)) {
+
+    if (!this->square_board) {
       IOH_error("Number of parameters in the N Queen problem must be a square number");
     }
 
-    for (index=0; index<n; index++) {
-        if (x[index]==1){
-          number_of_queens_on_board+=1;
-        }
-    }
+    std::vector<int> counts(6 * N_queens);
+    count_queens(x,counts.data(),number_of_queens_on_board);
 
-    for (j=1; j <=N_queens; j++) {
-        double sum_column = 0.0;
-        for (i=1; i<=N_queens; i++) {
-            indx=((i-1)*N_queens) + ((j-1)%N_queens);
-            sum_column+=(double)x[indx];
-        }
-        columns_penalty+=_max(0.0, (-1.0+sum_column));
+    int penalty = 0;
+    for (std::size_t line = 0; line != counts.size(); ++line) {
+      penalty += counts[line] > 1 ? counts[line] - 1 : 0;
     }
+    return (double) (number_of_queens_on_board - N_queens * penalty);
+  }
 
-    for (i=1; i<=N_queens; i++) {
-        double sum_raw = 0.0;
-        /*double sum_k = 0.0;
-        double sum_l = 0.0;*/
-        for (j=1; j <=N_queens; j++) {
-            indx=((i-1)*N_queens) + ((j-1)%N_queens);
-            sum_raw+=(double)x[indx];
-        }
-        raws_penalty+=_max(0.0, (-1.0+sum_raw));
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// Counts the queens on the lines of x, which are updated as bits are flipped.
+  void internal_prepare_flips(const std::vector<int> &x) {
+    if (!this->square_board) {
+      return;
     }
+    int number_of_queens_on_board = 0;
+    this->flip_counts.assign(6 * this->board_size,0);
+    count_queens(x,this->flip_counts.data(),number_of_queens_on_board);
+  }
 
-    for (k=2-N_queens; k<=N_queens-2; k++) {
-        double sum_k=0.0;
-        for (i=1; i<=N_queens; i++) {
-            if (k+i>=1 && k+i<=N_queens) {
-                indx=((i-1)*N_queens) + ((k+i-1)%N_queens);
-                sum_k += (double)x[indx];
-            }
-        }
-        k_penalty+=_max(0.0, (-1.0+sum_k));
+  /// Placing a queen on a line which has one already adds a penalty of one, removing a
+  /// queen from a line which has two or more removes one. The four lines of the square
+  /// are updated in O(1).
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    int lines[4];
+    square_lines((int)i,lines);
+    int penalty = 0;
+    if (x[i] == 1) {
+      for (int l = 0; l != 4; ++l) {
+        penalty -= (this->flip_counts[lines[l]] >= 2);
+      }
+      return raw_objective - 1.0 - (double)(this->board_size * penalty);
     }
-    for (l=3; l<=2*N_queens-1; l++)  {
-        double sum_l=0.0;
-        for (i=1; i<=N_queens; i++) {
-            if (l-i>=1 && l-i<=N_queens) {
-                indx=((i-1)*N_queens) + ((l-i-1)%N_queens);
-                sum_l += (double)x[indx];
-            }
-        }
-        l_penalty+=_max(0.0, (-1.0+sum_l));
+    for (int l = 0; l != 4; ++l) {
+      penalty += (this->flip_counts[lines[l]] >= 1);
+    }
+    return raw_objective + 1.0 - (double)(this->board_size * penalty);
+  }
+
+  void internal_accept_flip(const std::vector<int> &x, const std::size_t i) {
+    int lines[4];
+    square_lines((int)i,lines);
+    const int change = x[i] == 1 ? -1 : 1;
+    for (int l = 0; l != 4; ++l) {
+      this->flip_counts[lines[l]] += change;
     }
-    result = (double) (number_of_queens_on_board - (C*raws_penalty) - (C*columns_penalty) -(C*k_penalty) - (C*l_penalty));
-    return (double)result;
   }
 
   static NQueens * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new NQueens(instance_id, dimension);
   }
+
+private:
+  /// \fn void square_lines(const int index, int *lines) const
+  ///
+  /// The positions of the row, the column and the two diagonals of a square in the
+  /// counts: rows at [0, N), columns at [N, 2N), diagonals (by column - row) at [2N, 4N)
+  /// and anti-diagonals (by row + column) at [4N, 6N).
+  void square_lines(const int index, int *lines) const {
+    const int N_queens = this->board_size;
+    const int row = index / N_queens, column = index % N_queens;
+    lines[0] = row;
+    lines[1] = N_queens + column;
+    lines[2] = 3 * N_queens - 1 + column - row;
+    lines[3] = 4 * N_queens + row + column;
+  }
+
+  /// \fn void count_queens(const std::vector<int> &x, int *counts, int &number_of_queens_on_board) const
+  ///
+  /// Adds the queens of x to the counts of their lines.
+  void count_queens(const std::vector<int> &x, int *counts, int &number_of_queens_on_board) const {
+    const int n = this->board_size * this->board_size;
+    int lines[4];
+    for (int index = 0; index < n; ++index) {
+      if (x[index] == 1) {
+        number_of_queens_on_board += 1;
+        square_lines(index,lines);
+        for (int l = 0; l != 4; ++l) {
+          counts[lines[l]] += 1;
+        }
+      }
+    }
+  }
+
+  bool square_board = false; /// < whether the number of variables is a square number, checked by prepare_problem.
+  int board_size = 0; /// < the number of rows and columns of the board.
+  std::vector<int> flip_counts; /// < the queens on each line of the solution of start_flips.
 };
 
 #endif
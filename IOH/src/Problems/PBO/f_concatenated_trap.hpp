@@ -29,42 +29,185 @@ public:
 
   int k = 5;
 
+  bool instance_outdated() const {
+    return (int)this->trap_numerators.size() != k + 1;
+  }
+
+  /// \fn void prepare_problem()
+  ///
+  /// Computes the trap values of the blocks of k variables and of the remaining block, for
+  /// each number of ones, as integer numerators over the size of the block. The remaining
+  /// block also includes the last variable of the preceding block.
+  void prepare_problem() {
+    int n = IOHprofiler_get_number_of_variables();
+    int m = n / k;
+    this->remain_k = n - m * k;
+    this->trap_numerators.resize(k + 1);
+    for (int block_result = 0; block_result <= k; ++block_result) {
+      this->trap_numerators[block_result] = trap_numerator(block_result,k);
+    }
+    this->remain_numerators.resize(this->remain_k + 2);
+    for (int block_result = 0; block_result <= this->remain_k + 1; ++block_result) {
+      this->remain_numerators[block_result] = trap_numerator(block_result,this->remain_k);
+    }
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
     int n = x.size();
-    double result = 0.0;
-    double block_result;
+    int block_result;
+    const int *v = x.data();
 
     int m = n / k;
+    int64_t trap_sum = 0;
     for (int i = 1; i <= m; ++i) {
-      block_result = 0.0;
+      block_result = 0;
       for (int j = i*k - k; j != i*k; ++j) {
-        block_result += x[j];
+        block_result += v[j];
       }
-      if (block_result == k) {
-        result += 1;
-      } else {
-        result += ((double)(k - 1 - block_result) / (double) k );
+      trap_sum += this->trap_numerators[block_result];
+    }
+    int remain_numerator = 0;
+    if (this->remain_k != 0) {
+      block_result = 0;
+      for (int j = remain_start(m); j != n; ++j) {
+        block_result += v[j];
       }
+      remain_numerator = this->remain_numerators[block_result];
+    }
+
+    return objective(trap_sum,remain_numerator);
+  }
+
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  /// The ones of each block are counted by a masked popcount of the words it covers.
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    const int m = (int)n / k;
+    int64_t trap_sum = 0;
+    for (int b = 0; b != m; ++b) {
+      trap_sum += this->trap_numerators[packed_count_ones(x,(std::size_t)(b * k),(std::size_t)k)];
     }
-    int remain_k = n - m * k;
-    if (remain_k != 0 ) {
-      block_result = 0.0;
-      for (int j = m * k - 1; j != n; ++j) {
-        block_result += x[j];
+    int remain_numerator = 0;
+    if (this->remain_k != 0) {
+      const std::size_t begin = (std::size_t)remain_start(m);
+      remain_numerator = this->remain_numerators[packed_count_ones(x,begin,n - begin)];
+    }
+    return objective(trap_sum,remain_numerator);
+  }
+
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// Counts the ones of each block of x and sums the numerators of the blocks, which are
+  /// updated as bits are flipped.
+  void internal_prepare_flips(const std::vector<int> &x) {
+    int n = x.size();
+    int m = n / k;
+    int blocks = m + (this->remain_k != 0 ? 1 : 0);
+    this->flip_block_results.assign(blocks,0);
+    this->flip_trap_sum = 0;
+    this->flip_remain_numerator = 0;
+    for (int b = 0; b != blocks; ++b) {
+      const int begin = b < m ? b * k : remain_start(m);
+      const int end = b < m ? (b + 1) * k : n;
+      for (int j = begin; j != end; ++j) {
+        this->flip_block_results[b] += x[j];
       }
-      if (block_result == remain_k) {
-        result += 1;
+      if (b < m) {
+        this->flip_trap_sum += this->trap_numerators[this->flip_block_results[b]];
       } else {
-        result += ((double)(remain_k - 1 - block_result) / (double) remain_k );
+        this->flip_remain_numerator = this->remain_numerators[this->flip_block_results[b]];
       }
     }
+  }
 
-    return result;
+  /// Only the blocks containing x[i] change. The sums are integers, so the result equals
+  /// the complete evaluation.
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    int64_t trap_sum = this->flip_trap_sum;
+    int remain_numerator = this->flip_remain_numerator;
+    flipped_sums(x,i,trap_sum,remain_numerator);
+    return objective(trap_sum,remain_numerator);
+  }
+
+  void internal_accept_flip(const std::vector<int> &x, const std::size_t i) {
+    int blocks[2];
+    const int number_of_blocks = blocks_of((int)x.size(),(int)i,blocks);
+    const int change = x[i] ? -1 : 1;
+    flipped_sums(x,i,this->flip_trap_sum,this->flip_remain_numerator);
+    for (int c = 0; c != number_of_blocks; ++c) {
+      this->flip_block_results[blocks[c]] += change;
+    }
   }
 
   static Concatenated_Trap * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new Concatenated_Trap(instance_id, dimension);
   }
+
+private:
+  /// The value of a block of block_size variables with block_result ones, times block_size.
+  static int trap_numerator(const int block_result, const int block_size) {
+    if (block_result == block_size) {
+      return block_size;
+    }
+    return block_size - 1 - block_result;
+  }
+
+  double objective(const int64_t trap_sum, const int remain_numerator) const {
+    double result = (double)trap_sum / (double)k;
+    if (this->remain_k != 0) {
+      result += (double)remain_numerator / (double)this->remain_k;
+    }
+    return result;
+  }
+
+  /// The first variable of the remaining block after m blocks of k variables.
+  int remain_start(const int m) const {
+    return m > 0 ? m * k - 1 : 0;
+  }
+
+  /// Updates trap_sum and remain_numerator of the solution of start_flips for flipping x[i].
+  void flipped_sums(const std::vector<int> &x, const std::size_t i, int64_t &trap_sum, int &remain_numerator) const {
+    int blocks[2];
+    const int number_of_blocks = blocks_of((int)x.size(),(int)i,blocks);
+    const int change = x[i] ? -1 : 1;
+    int m = (int)x.size() / k;
+    for (int c = 0; c != number_of_blocks; ++c) {
+      const int b = blocks[c];
+      const int block_result = this->flip_block_results[b];
+      if (b < m) {
+        trap_sum += this->trap_numerators[block_result + change] - this->trap_numerators[block_result];
+      } else {
+        remain_numerator = this->remain_numerators[block_result + change];
+      }
+    }
+  }
+
+  /// \fn int blocks_of(const int n, const int i, int *blocks) const
+  ///
+  /// Writes the blocks containing the variable i into blocks and returns their number,
+  /// which is 2 for the last variable of the last complete block if there is a remaining block.
+  int blocks_of(const int n, const int i, int *blocks) const {
+    int m = n / k;
+    int number_of_blocks = 0;
+    if (i < m * k) {
+      blocks[number_of_blocks++] = i / k;
+    }
+    if (this->remain_k != 0 && i >= remain_start(m)) {
+      blocks[number_of_blocks++] = m;
+    }
+    return number_of_blocks;
+  }
+
+  int remain_k = 0; /// < the number of variables after the last block of k variables.
+  std::vector<int> trap_numerators; /// < the value of a block of k variables with a given number of ones, times k.
+  std::vector<int> remain_numerators; /// < the value of the remaining block with a given number of ones, times remain_k.
+  std::vector<int> flip_block_results; /// < the number of ones of each block of the solution of start_flips.
+  int64_t flip_trap_sum = 0; /// < the sum of trap_numerators over the blocks of k variables of the solution of start_flips.
+  int flip_remain_numerator = 0; /// < the remain_numerators entry of the solution of start_flips.
 };
 
 #endif
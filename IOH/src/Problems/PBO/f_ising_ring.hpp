@@ -29,15 +29,29 @@ public:
     return (x % N + N) %N;
   }
 
+  void prepare_problem() {
+    int n = IOHprofiler_get_number_of_variables();
+    IOHprofiler_set_integer_objective_range(-n, n);
+  }
+
+  /// The term x[i] * x[j] - (1 - x[i]) * (1 - x[j]) of an edge equals x[i] + x[j] - 1
+  /// for binary variables. As each variable is in the two edges to its neighbours on the
+  /// ring, the objective is 2 * |x|_1 - n, and a flip changes it by 2 or -2.
   double internal_evaluate(const std::vector<int> &x) {
     int result = 0, n = x.size();
-
-    int neig;
+    const int *v = x.data();
     for (int i = 0; i < n; ++i) {
-      neig = x[modulo_ising_ring((i - 1) , n)];
-      result += (x[i] * neig) - ((1 - x[i]) * (1 - neig));
+      result += v[i];
     }
-    return (double)result;
+    return (double)(2 * result - n);
+  }
+
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    return raw_objective + (double)(2 * (1 - 2 * x[i]));
   }
 
   static Ising_Ring * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
@@ -29,33 +29,44 @@ public:
     return (x % N + N) %N;
   }
 
+  void prepare_problem() {
+    int n = IOHprofiler_get_number_of_variables();
+    IOHprofiler_set_integer_objective_range(-2 * n, 2 * n);
+    this->square_lattice = (floor(sqrt((double)n)) == sqrt((double)n));
+  }
+
+  /// The term x[i] * x[j] - (1 - x[i]) * (1 - x[j]) of an edge equals x[i] + x[j] - 1
+  /// for binary variables. As each variable is in the four edges to its neighbours on the
+  /// torus, the objective is 4 * |x|_1 - 2 * n, and a flip changes it by 4 or -4.
   double internal_evaluate(const std::vector<int> &x) {
     int n = x.size();
-    int i, j, neig;
     int result= 0;
-    int neighbors[2];
-    int lattice_size = (int)sqrt((double)n);
-    
-    if(floor(sqrt((double)n))!=sqrt((double)n)) {
+
+    if(!this->square_lattice) {
       IOH_error("Number of parameters in the Ising square problem must be a square number");
     }
 
-    for(i = 0; i < lattice_size; ++i) {
-      for (j = 0; j < lattice_size; ++j) {
-        neighbors[0]  = x[modulo_ising_torus(i + 1, lattice_size) * lattice_size + j];
-        neighbors[1]  = x[i * lattice_size + modulo_ising_torus((j + 1) , lattice_size)];
-        for (neig = 0; neig < 2; neig++) {
-          result += (x[i*lattice_size + j] * neighbors[neig]) - ((1 - x[i * lattice_size + j]) * (1 - neighbors[neig]));
-        }
-      }
+    const int *v = x.data();
+    for (int i = 0; i < n; ++i) {
+      result += v[i];
     }
+    return (double)(4 * result - 2 * n);
+  }
 
-    return (double)result;
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    return raw_objective + (double)(4 * (1 - 2 * x[i]));
   }
 
   static Ising_Torus * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION)  {
     return new Ising_Torus(instance_id, dimension);
   }
+
+private:
+  bool square_lattice = false; /// < whether the number of variables is a square number, checked by prepare_problem.
 };
 
 #endif
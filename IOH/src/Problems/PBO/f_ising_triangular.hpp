@@ -31,30 +31,45 @@ public:
     return (x % N + N) % N;
   }
 
+  void prepare_problem() {
+    int n = IOHprofiler_get_number_of_variables();
+    IOHprofiler_set_integer_objective_range(-3 * n, 3 * n);
+    int lattice_size = (int)sqrt((double)n);
+    this->lattice_variables = lattice_size * lattice_size;
+  }
+
+  /// The term x[i] * x[j] - (1 - x[i]) * (1 - x[j]) of an edge equals x[i] + x[j] - 1
+  /// for binary variables. As each variable of the lattice is in the six edges to its
+  /// neighbours, the objective is 6 * |x|_1 - 3 * m for the m variables of the lattice,
+  /// and a flip of one of them changes it by 6 or -6. Variables beyond the largest
+  /// square lattice do not contribute.
   double internal_evaluate(const std::vector<int> &x) {
-    int i, j, neig;
-    int n = x.size();
+    int m = std::min((int)x.size(),this->lattice_variables);
     int result = 0;
-    int neighbors[3];
-    int lattice_size = (int)sqrt((double)n);
-    
-    for (i = 0; i < lattice_size; ++i) {
-      for (j = 0; j < lattice_size; ++j) {
-        neighbors[0] = x[modulo_ising_triangular((i + 1), lattice_size) * lattice_size + j];
-        neighbors[1] = x[i * lattice_size + modulo_ising_triangular((j + 1), lattice_size)];
-        neighbors[2] = x[modulo_ising_triangular((i + 1) , lattice_size) * lattice_size + modulo_ising_triangular((j + 1), lattice_size)];
-
-        for (neig=0; neig < 3; neig++) {
-          result += (x[i * lattice_size + j] * neighbors[neig]) - ((1 - x[i * lattice_size + j]) * (1 - neighbors[neig]));
-        }
-      }
+    const int *v = x.data();
+    for (int i = 0; i < m; ++i) {
+      result += v[i];
+    }
+    return (double)(6 * result - 3 * m);
+  }
+
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    if ((int)i >= this->lattice_variables) {
+      return raw_objective;
     }
-    return (double)result;
+    return raw_objective + (double)(6 * (1 - 2 * x[i]));
   }
 
   static Ising_Triangular * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new Ising_Triangular(instance_id, dimension);
   }
+
+private:
+  int lattice_variables = 0; /// < the number of variables of the largest square lattice, set by prepare_problem.
 };
 
 #endif
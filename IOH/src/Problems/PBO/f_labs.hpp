@@ -24,42 +24,79 @@ public:
   
   ~LABS() {}
 
-  double correlation(const std::vector<int> x, const int n, int k)
-  {
-    int x1,x2;
-    double result;
-    result = 0.0;
-    for (int i = 0 ; i < n - k; ++i) {
-        if (x[i] == 0) {
-          x1 = -1;
-        } else {
-          x1 = 1;
-        }
-        if (x[i + k] == 0) {
-          x2 = -1;
-        } else {
-          x2 = 1;
-        }
-        result += x1 * x2;
+  /// The autocorrelation C_k of x as a +1/-1 sequence, i.e., the number of equal pairs
+  /// (x[i], x[i + k]) minus the number of different ones.
+  long long correlation(const std::vector<int> &x, const int n, const int k) const {
+    const int *v = x.data();
+    long long different = 0;
+    for (int i = 0; i < n - k; ++i) {
+      different += (v[i] != v[i + k]);
     }
-    return result;
+    return (long long)(n - k) - 2 * different;
   }
 
   double internal_evaluate(const std::vector<int> &x) {
+    int n = x.size();
+    double result = 0.0, cor;
+    for (int k = 1; k < n; ++k) {
+      cor = (double)correlation(x,n,k);
+      result += cor * cor;
+    }
+    result = (double)(n*n)/2.0/result;
+    return (double)result;
+  }
+
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// Computes the autocorrelations of x, which are updated as bits are flipped.
+  void internal_prepare_flips(const std::vector<int> &x) {
+    int n = x.size();
+    this->flip_correlations.assign(n > 0 ? n : 1, 0);
+    for (int k = 1; k < n; ++k) {
+      this->flip_correlations[k] = correlation(x,n,k);
+    }
+  }
 
+  /// Flipping x[i] negates the products x[i] * x[i + k] and x[i - k] * x[i], so that each
+  /// autocorrelation changes by -2 times their sum, and the energy is recomputed in O(n).
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
     int n = x.size();
     double result = 0.0, cor;
-    for (int k = 1; k != n; ++k) {
-      cor = correlation(x,n,k);
+    for (int k = 1; k < n; ++k) {
+      cor = (double)(this->flip_correlations[k] - 2 * flip_change(x,n,(int)i,k));
       result += cor * cor;
     }
     result = (double)(n*n)/2.0/result;
     return (double)result;
   }
-  
+
+  void internal_accept_flip(const std::vector<int> &x, const std::size_t i) {
+    int n = x.size();
+    for (int k = 1; k < n; ++k) {
+      this->flip_correlations[k] -= 2 * flip_change(x,n,(int)i,k);
+    }
+  }
+
   static LABS * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new LABS(instance_id, dimension);
   }
+
+private:
+  /// The sum of the products x[i] * x[i + k] and x[i - k] * x[i] (as +1/-1) that exist.
+  static long long flip_change(const std::vector<int> &x, const int n, const int i, const int k) {
+    long long result = 0;
+    if (i + k < n) {
+      result += (x[i] == x[i + k]) ? 1 : -1;
+    }
+    if (i - k >= 0) {
+      result += (x[i - k] == x[i]) ? 1 : -1;
+    }
+    return result;
+  }
+
+  std::vector<long long> flip_correlations; /// < the autocorrelations C_k of the solution of start_flips.
 };
 
 #endif
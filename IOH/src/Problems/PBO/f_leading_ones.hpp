@@ -26,18 +26,48 @@ public:
   
   ~LeadingOnes() {}
 
+  void prepare_problem() {
+    IOHprofiler_set_integer_objective_range(0, IOHprofiler_get_number_of_variables());
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
     int n = x.size();
     int result = 0;
-    for (int i = 0; i != n; ++i) {
-      if(x[i] == 1)
-        result = i + 1;
-      else
-        break;
+    while (result != n && x[result] == 1) {
+      ++result;
+    }
+    return (double)result;
+  }
+
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// Flipping one of the leading ones cuts them at i, flipping the first zero extends them by
+  /// the ones following it, and flipping any other variable does not change them.
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    const std::size_t leading_ones = (std::size_t)raw_objective;
+    if (i < leading_ones) {
+      return (double)i;
+    }
+    if (i > leading_ones) {
+      return raw_objective;
+    }
+    std::size_t result = i + 1;
+    while (result != x.size() && x[result] == 1) {
+      ++result;
     }
     return (double)result;
   }
   
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    return (double)packed_leading_ones(x,n);
+  }
+
   static LeadingOnes * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new LeadingOnes(instance_id, dimension);
   }
@@ -31,6 +31,18 @@ public:
   std::vector<int> info;
   void prepare_problem() {
     info = dummy(IOHprofiler_get_number_of_variables(),0.5,10000);
+    this->info_rank.assign(IOHprofiler_get_number_of_variables(),-1);
+    for (std::size_t i = 0; i != info.size(); ++i) {
+      this->info_rank[info[i]] = (int)i;
+    }
+    dummy_mask(info,IOHprofiler_get_number_of_variables(),this->info_mask);
+    this->info_mask_prefix.resize(this->info_mask.size());
+    int selected = 0;
+    for (std::size_t w = 0; w != this->info_mask.size(); ++w) {
+      this->info_mask_prefix[w] = selected;
+      selected += packed_popcount(this->info_mask[w]);
+    }
+    IOHprofiler_set_integer_objective_range(0, info.size());
   }
 
   double internal_evaluate(const std::vector<int> &x) {
@@ -46,9 +58,55 @@ public:
     return (double)result;
   }
 
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// The leading ones are counted on the selected variables, see LeadingOnes::internal_evaluate_flip.
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    const int rank = this->info_rank[i];
+    const int leading_ones = (int)raw_objective;
+    if (rank < 0 || rank > leading_ones) {
+      return raw_objective;
+    }
+    if (rank < leading_ones) {
+      return (double)rank;
+    }
+    int n = this->info.size();
+    int result = rank + 1;
+    while (result != n && x[this->info[result]] == 1) {
+      ++result;
+    }
+    return (double)result;
+  }
+
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  /// As info is sorted, the leading ones end at the first selected variable which is 0, and
+  /// their number is the number of selected variables before it.
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    const std::size_t words = packed_words(n);
+    const uint64_t *mask = this->info_mask.data();
+    for (std::size_t w = 0; w != words; ++w) {
+      const uint64_t zeros = mask[w] & ~x[w];
+      if (zeros != 0) {
+        const uint64_t before = (zeros & (0 - zeros)) - 1;
+        return (double)(this->info_mask_prefix[w] + packed_popcount(mask[w] & before));
+      }
+    }
+    return (double)this->info.size();
+  }
+
   static LeadingOnes_Dummy1 * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new LeadingOnes_Dummy1(instance_id, dimension);
   }
+
+private:
+  std::vector<int> info_rank; /// < the position of each variable in info, -1 if it is not selected.
+  std::vector<uint64_t> info_mask; /// < the variables in info, packed.
+  std::vector<int> info_mask_prefix; /// < the number of variables in info before each word of info_mask.
 };
 
 #endif
@@ -30,9 +30,14 @@ public:
     IOHprofiler_set_optimal(IOHprofiler_get_number_of_variables());
   }
   
+  void prepare_problem() {
+    IOHprofiler_set_integer_objective_range(0, IOHprofiler_get_number_of_variables());
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
 
-    std::vector<int> new_variables = epistasis(x,4);
+    static thread_local std::vector<int> new_variables;
+    epistasis(x,4,new_variables);
     int n = new_variables.size();
     int result = 0;
     for (int i = 0; i != n; ++i) {
@@ -45,6 +50,17 @@ public:
     return (double)result;
   }
   
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    static thread_local std::vector<uint64_t> new_variables;
+    new_variables.resize(packed_words(n));
+    epistasis_packed(x,n,4,new_variables.data());
+    return (double)packed_leading_ones(new_variables.data(),n);
+  }
+
   static LeadingOnes_Epistasis * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new LeadingOnes_Epistasis(instance_id, dimension);
   }
@@ -30,11 +30,45 @@ public:
     IOHprofiler_set_number_of_variables(dimension);
   }
 
+  void prepare_problem() {
+    long long n = IOHprofiler_get_number_of_variables();
+    IOHprofiler_set_integer_objective_range(0, n * (n + 1) / 2);
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
     int n = x.size();
-    double result = 0;
+    long long result = 0;
     for (int i = 0; i < n; ++i) {
-      result += (double)x[i] * (double)(i + 1);
+      result += (long long)x[i] * (i + 1);
+    }
+    return (double)result;
+  }
+
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    return x[i] ? raw_objective - (double)(i + 1) : raw_objective + (double)(i + 1);
+  }
+
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  /// The weights i + 1 of the ones are summed per byte: a byte of value v starting at variable
+  /// i contributes popcount(v) * (i + 1) plus the sum of the positions of its ones within the
+  /// byte, which is looked up in a table.
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    const std::vector<int> &positions = byte_positions();
+    const std::size_t words = packed_words(n);
+    long long result = 0;
+    for (std::size_t w = 0; w != words; ++w) {
+      uint64_t word = x[w];
+      for (long long i = (long long)w * 64 + 1; word != 0; i += 8, word >>= 8) {
+        const int v = (int)(word & 255);
+        result += packed_popcount(v) * i + positions[v];
+      }
     }
     return (double)result;
   }
@@ -42,6 +76,22 @@ public:
   static Linear * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new Linear(instance_id, dimension);
   }
+
+private:
+  /// \fn static const std::vector<int> &byte_positions()
+  /// \brief The sum of the positions of the ones of each byte.
+  static const std::vector<int> &byte_positions() {
+    static const std::vector<int> positions = []() {
+      std::vector<int> sums(256,0);
+      for (int v = 0; v != 256; ++v) {
+        for (int j = 0; j != 8; ++j) {
+          sums[v] += ((v >> j) & 1) * j;
+        }
+      }
+      return sums;
+    }();
+    return positions;
+  }
 };
 
 #endif
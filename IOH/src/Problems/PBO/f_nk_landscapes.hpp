@@ -9,6 +9,11 @@
 #define _F_NK_LANDSCAPES_H
 
 #include "IOHprofiler_problem.h"
+#include "IOHprofiler_instance_cache.h"
+
+/// The contributions of F are drawn as s / NK_CONTRIBUTION_SCALE for integers s, see
+/// IOHprofiler_uniform_rand.
+#define NK_CONTRIBUTION_SCALE 2.147483647e9
 
 class NK_Landscapes : public IOHprofiler_random, public IOHprofiler_problem<int> {
 public:
@@ -28,70 +33,262 @@ public:
   std::vector<std::vector<int>> E;
   int k = 1;
 
+  /// \fn void set_n_k(const int n, const int k)
+  ///
+  /// Generates the interactions and the contribution tables of the landscape, or loads
+  /// them from the instance cache. The landscape only depends on n and k, so it is not
+  /// generated again if they did not change.
   void set_n_k(const int n, const int k) {
+    this->invalidate_instance();
+    if (n == this->generated_n && k == this->generated_k) {
+      this->k = k;
+      return;
+    }
+    this->generated_n = -1;
     E.clear();
     F.clear();
     this->k = k;
     if(k > n) {
       IOH_error("NK_Landscapes, k > n");
     }
+    std::ostringstream key;
+    key << "nk_landscapes_" << n << "_" << k;
+    if (!load_tables(key.str(), n, k)) {
+      generate_tables(n, k);
+      store_tables(key.str());
+    }
+    flatten_tables(n);
+    this->generated_n = n;
+    this->generated_k = k;
+  }
+
+  /// \fn void generate_tables(const int n, const int k)
+  ///
+  /// Draws the interactions E and the contribution tables F of the landscape. The
+  /// k interactions of each variable are drawn in O(k) by a partial Fisher-Yates shuffle
+  /// of a permutation of [0, n), which is undone afterwards.
+  void generate_tables(const int n, const int k) {
     std::vector<double> rand_vec;
+    std::vector<int> population(n);
+    for (int i = 0; i < n; ++i) {
+      population[i] = i;
+    }
+    std::vector<int> swapped;
+    E.resize(n);
     for (int i = 0;i != n; ++i) {
         IOHprofiler_uniform_rand((size_t)k,(long)(k * (i+1)),rand_vec);
 
-
-        std::vector<int> sampled_number;
-        std::vector<int> population;
-        for(int i = 0; i < n; ++i) {
-            population.push_back(i);
-        }
-
+        std::vector<int> &sampled_number = E[i];
+        sampled_number.reserve(k);
+        swapped.clear();
         int temp,randPos;
-        for(int i = n-1; i > 0; --i) {
-            randPos = (int)floor(rand_vec[n-1-i] * (i+1));
-            temp = population[i];
-            population[i] = population[randPos];
+        for(int j = n-1; j > 0 && n-1-j < k; --j) {
+            randPos = (int)floor(rand_vec[n-1-j] * (j+1));
+            temp = population[j];
+            population[j] = population[randPos];
             population[randPos] = temp;
-            sampled_number.push_back(population[i]);
-            if(n-i-1 == k-1) {
-            break;
-            }
+            swapped.push_back(randPos);
+            sampled_number.push_back(population[j]);
         }
         if(n == k) {
           sampled_number.push_back(population[0]);
         }
-        E.push_back(sampled_number);
+
+        /// undo the swaps, so that population is [0, n) again
+        for (int s = (int)swapped.size() - 1; s >= 0; --s) {
+            const int j = n-1-s;
+            temp = population[j];
+            population[j] = population[swapped[s]];
+            population[swapped[s]] = temp;
+        }
     }
+    F.resize(n);
     for (int i = 0; i != n; ++i) {
-        IOHprofiler_uniform_rand((size_t)pow(2,k+1),(long)(k * (i+1) * 2),rand_vec);
-        F.push_back(rand_vec);
+        IOHprofiler_uniform_rand((size_t)pow(2,k+1),(long)(k * (i+1) * 2),F[i]);
     }
   }
 
+  /// \fn bool load_tables(const std::string &key, const int n, const int k)
+  ///
+  /// Loads E and F from the instance cache. The interactions are stored as doubles, which
+  /// represent them exactly.
+  bool load_tables(const std::string &key, const int n, const int k) {
+    std::vector<double> data;
+    const std::size_t table_size = (std::size_t)1 << (k + 1);
+    if (!IOHprofiler_instance_cache::load(key, data) || data.size() != (std::size_t)n * (k + table_size)) {
+      return false;
+    }
+    std::vector<double>::const_iterator value = data.begin();
+    E.resize(n);
+    for (int i = 0; i != n; ++i, value += k) {
+      E[i].assign(value, value + k);
+    }
+    F.resize(n);
+    for (int i = 0; i != n; ++i, value += table_size) {
+      F[i].assign(value, value + table_size);
+    }
+    return true;
+  }
+
+  /// \fn void store_tables(const std::string &key)
+  ///
+  /// Stores the tables loaded by load_tables() in the instance cache.
+  void store_tables(const std::string &key) {
+    if (IOHprofiler_instance_cache::get_directory().empty()) {
+      return;
+    }
+    std::vector<double> data;
+    for (std::size_t i = 0; i != E.size(); ++i) {
+      data.insert(data.end(), E[i].begin(), E[i].end());
+    }
+    for (std::size_t i = 0; i != F.size(); ++i) {
+      data.insert(data.end(), F[i].begin(), F[i].end());
+    }
+    IOHprofiler_instance_cache::store(key, data);
+  }
+
   void prepare_problem() {
     set_n_k(IOHprofiler_get_number_of_variables(),k);
   }
 
+  bool instance_outdated() const {
+    return k != this->generated_k;
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
   
     int n = x.size();
     double result = 0;
-    int index;
-    for (int i = 0; i != n; ++i) {
-      index= x[i];
+    const int *v = x.data();
+    const int *interaction = this->interactions.data();
+    const int *weight = this->bit_weights.data();
+    const int64_t *table = this->contributions.data();
+    int64_t sum = 0;
+    for (int i = 0; i != n; ++i, interaction += k, table += this->table_size) {
+      int index = v[i];
+      for (int j = 0; j != k; ++j) {
+        index += weight[j] * v[interaction[j]];
+      }
+      sum += table[index];
+    }
+
+    result = this->objective(sum, n);
+    return -result;
+  }
+
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// Computes the table index of each contribution for x, and the sum of the contributions.
+  void internal_prepare_flips(const std::vector<int> &x) {
+    int n = x.size();
+    this->flip_indices.resize(n);
+    this->flip_sum = 0;
+    const int *interaction = this->interactions.data();
+    for (int i = 0; i != n; ++i, interaction += k) {
+      int index = x[i];
       for (int j = 0; j != k; ++j) {
-        index = index + pow(2,(j+1)) * x[E[i][j]];
+        index += this->bit_weights[j] * x[interaction[j]];
       }
-      result += F[i][index];
+      this->flip_indices[i] = index;
+      this->flip_sum += this->contributions[(std::size_t)i * this->table_size + index];
     }
+  }
 
-    result = result / (double)n;
+  /// Only the contributions depending on x[i] are looked up again, and their change is
+  /// added to the sum of the contributions, so a flip is evaluated in O(k). The sum is
+  /// exact, so the result equals the one of internal_evaluate.
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    int n = x.size();
+    int64_t sum = this->flip_sum;
+    for (int d = this->dependent_offsets[i]; d != this->dependent_offsets[i + 1]; ++d) {
+      const int c = this->dependent_contributions[d];
+      const int64_t *table = this->contributions.data() + (std::size_t)c * this->table_size;
+      const int index = this->flip_indices[c];
+      sum += table[index + (x[i] ? -this->dependent_weights[d] : this->dependent_weights[d])] - table[index];
+    }
+
+    double result = this->objective(sum, n);
     return -result;
   }
 
+  void internal_accept_flip(const std::vector<int> &x, const std::size_t i) {
+    for (int d = this->dependent_offsets[i]; d != this->dependent_offsets[i + 1]; ++d) {
+      const int c = this->dependent_contributions[d];
+      const int64_t *table = this->contributions.data() + (std::size_t)c * this->table_size;
+      const int index = this->flip_indices[c] + (x[i] ? -this->dependent_weights[d] : this->dependent_weights[d]);
+      this->flip_sum += table[index] - table[this->flip_indices[c]];
+      this->flip_indices[c] = index;
+    }
+  }
+
   static NK_Landscapes * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new NK_Landscapes(instance_id, dimension);
   }
+
+private:
+  /// \fn double objective(const int64_t sum, const int n)
+  ///
+  /// The mean of the contributions whose integers s sum up to sum.
+  static double objective(const int64_t sum, const int n) {
+    return (double)sum / NK_CONTRIBUTION_SCALE / (double)n;
+  }
+
+  /// \fn void flatten_tables(const int n)
+  ///
+  /// Copies E and F into contiguous arrays and lists the contributions depending on
+  /// each variable, with the weight of the variable in the index of the contribution.
+  /// The contributions are stored as their integers s, which are summed exactly.
+  void flatten_tables(const int n) {
+    this->table_size = (std::size_t)1 << (k + 1);
+    this->bit_weights.resize(k);
+    for (int j = 0; j != k; ++j) {
+      this->bit_weights[j] = 1 << (j + 1);
+    }
+
+    this->interactions.resize((std::size_t)n * k);
+    this->contributions.resize((std::size_t)n * this->table_size);
+    std::vector<std::vector<std::pair<int,int> > > dependents(n);
+    for (int i = 0; i != n; ++i) {
+      for (std::size_t index = 0; index != this->table_size; ++index) {
+        this->contributions[(std::size_t)i * this->table_size + index] = (int64_t)std::llround(F[i][index] * NK_CONTRIBUTION_SCALE);
+      }
+      dependents[i].push_back(std::make_pair(i,1));
+      for (int j = 0; j != k; ++j) {
+        const int variable = E[i][j];
+        this->interactions[(std::size_t)i * k + j] = variable;
+        if (!dependents[variable].empty() && dependents[variable].back().first == i) {
+          dependents[variable].back().second += this->bit_weights[j];
+        } else {
+          dependents[variable].push_back(std::make_pair(i,this->bit_weights[j]));
+        }
+      }
+    }
+
+    this->dependent_offsets.assign(1,0);
+    this->dependent_contributions.clear();
+    this->dependent_weights.clear();
+    for (int i = 0; i != n; ++i) {
+      for (std::size_t d = 0; d != dependents[i].size(); ++d) {
+        this->dependent_contributions.push_back(dependents[i][d].first);
+        this->dependent_weights.push_back(dependents[i][d].second);
+      }
+      this->dependent_offsets.push_back((int)this->dependent_contributions.size());
+    }
+  }
+
+  std::vector<int> interactions; /// < E[i][j] at i * k + j.
+  std::vector<int64_t> contributions; /// < the integer s of F[i][index] at i * table_size + index.
+  std::vector<int> bit_weights; /// < the weight 2^(j + 1) of E[i][j] in the index of F[i].
+  std::size_t table_size; /// < 2^(k + 1).
+  std::vector<int> dependent_offsets; /// < the dependents of variable i are at [dependent_offsets[i], dependent_offsets[i + 1]).
+  std::vector<int> dependent_contributions; /// < the contributions depending on a variable.
+  std::vector<int> dependent_weights; /// < the weight of the variable in the index of the contribution.
+  std::vector<int> flip_indices; /// < the index of each contribution for the solution of start_flips.
+  int64_t flip_sum = 0; /// < the sum of the contributions at flip_indices.
+  int generated_n = -1; /// < the n of the generated landscape, -1 if there is none.
+  int generated_k = -1; /// < the k of the generated landscape.
 };
 
 #endif
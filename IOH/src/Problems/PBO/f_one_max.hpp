@@ -25,6 +25,10 @@ public:
   
   ~OneMax() {}
 
+  void prepare_problem() {
+    IOHprofiler_set_integer_objective_range(0, IOHprofiler_get_number_of_variables());
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
   
     size_t n = x.size();
@@ -35,6 +39,22 @@ public:
     return (double)result;
   }
 
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    return x[i] ? raw_objective - 1.0 : raw_objective + 1.0;
+  }
+
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    return (double)packed_count_ones(x,n);
+  }
+
   static OneMax * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new OneMax(instance_id, dimension);
   }
@@ -30,6 +30,12 @@ public:
   std::vector<int> info;
   void prepare_problem() {
     info = dummy(IOHprofiler_get_number_of_variables(),0.5,10000);
+    this->info_rank.assign(IOHprofiler_get_number_of_variables(),-1);
+    for (std::size_t i = 0; i != info.size(); ++i) {
+      this->info_rank[info[i]] = (int)i;
+    }
+    dummy_mask(info,IOHprofiler_get_number_of_variables(),this->info_mask);
+    IOHprofiler_set_integer_objective_range(0, info.size());
   }
 
   double internal_evaluate(const std::vector<int> &x) {
@@ -41,9 +47,40 @@ public:
     return (double)result;
   }
   
+  bool internal_flip_supported() const {
+    return true;
+  }
+
+  /// Only the flips of the selected variables change the objective.
+  double internal_evaluate_flip(const std::vector<int> &x, const std::size_t i, const double raw_objective) {
+    if (this->info_rank[i] < 0) {
+      return raw_objective;
+    }
+    return x[i] ? raw_objective - 1.0 : raw_objective + 1.0;
+  }
+
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  /// The selected variables are counted by popcount on the mask of info.
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    const std::size_t words = packed_words(n);
+    const uint64_t *mask = this->info_mask.data();
+    int result = 0;
+    for (std::size_t w = 0; w != words; ++w) {
+      result += packed_popcount(x[w] & mask[w]);
+    }
+    return (double)result;
+  }
+
   static OneMax_Dummy1 * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new OneMax_Dummy1(instance_id, dimension);
   }
+
+private:
+  std::vector<int> info_rank; /// < the position of each variable in info, -1 if it is not selected.
+  std::vector<uint64_t> info_mask; /// < the variables in info, packed.
 };
 
 #endif
@@ -28,9 +28,14 @@ public:
   
   ~OneMax_Neutrality() {}
 
+  void prepare_problem() {
+    IOHprofiler_set_integer_objective_range(0, IOHprofiler_get_number_of_variables() / 3);
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
     
-    std::vector<int> new_variables = neutrality(x,3);
+    static thread_local std::vector<int> new_variables;
+    neutrality(x,3,new_variables);
     int n = new_variables.size();
     int result = 0;
     for (int i = 0; i != n; ++i) {
@@ -39,6 +44,14 @@ public:
     return (double)result;
   }
 
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    return (double)neutrality_count_ones(x,n,3);
+  }
+
   static OneMax_Neutrality * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new OneMax_Neutrality(instance_id, dimension);
   }
@@ -28,6 +28,15 @@ public:
   
   ~OneMax_Ruggedness2() {}
 
+  void prepare_problem() {
+    IOHprofiler_set_integer_objective_range(0, IOHprofiler_get_number_of_variables() + 1);
+    int n = IOHprofiler_get_number_of_variables();
+    this->ruggedness_values.resize(n + 1);
+    for (int y = 0; y <= n; ++y) {
+      this->ruggedness_values[y] = (int)ruggedness2(y,n);
+    }
+  }
+
   double internal_evaluate(const std::vector<int> &x) {
     
     int n = x.size();
@@ -35,14 +44,26 @@ public:
     for (int i = 0; i != n; ++i) {
       result += x[i];
     }
-    result = ruggedness2(result,n);
+    result = this->ruggedness_values[result];
     return (double)result;
   }
 
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    int result = packed_count_ones(x,n);
+    result = this->ruggedness_values[result];
+    return (double)result;
+  }
 
   static OneMax_Ruggedness2 * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new OneMax_Ruggedness2(instance_id, dimension);
   }
+
+private:
+  std::vector<int> ruggedness_values; /// < ruggedness2(y, n) for y = 0, ..., n, computed by prepare_problem.
 };
 
 #endif
@@ -30,6 +30,7 @@ public:
   std::vector<double> info;
   void prepare_problem() {
     info = ruggedness3(IOHprofiler_get_number_of_variables());
+    IOHprofiler_set_integer_objective_range(0, IOHprofiler_get_number_of_variables());
   }
   
   double internal_evaluate(const std::vector<int> &x) {
@@ -43,6 +44,16 @@ public:
     return (double)result;
   }
   
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    int result = packed_count_ones(x,n);
+    result = this->info[result];
+    return (double)result;
+  }
+
   static OneMax_Ruggedness3 * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new OneMax_Ruggedness3(instance_id, dimension);
   }
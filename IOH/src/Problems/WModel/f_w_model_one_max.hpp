@@ -45,6 +45,7 @@ public:
     if (this->ruggedness_para > 0) {
       this->ruggedness_info = ruggedness_raw(ruggedness_translate(this->ruggedness_para, this->temp_dimension), this->temp_dimension); 
     }
+    IOHprofiler_set_integer_objective_range(0, this->temp_dimension);
   }
 
   void customize_optimal() {
@@ -68,35 +69,18 @@ public:
     this->epistasis_para = epistasis_para;
     this->neutrality_para = neutrality_para;
     this->ruggedness_para = ruggedness_para;
+    this->invalidate_instance();
   }
 
+  /// The layers are computed into buffers of the calling thread, so that an evaluation
+  /// does not allocate memory and the problem is not modified.
   double internal_evaluate(const std::vector<int> &x) {
-    std::vector<int> w_model_x;
-    std::vector<int> tempX;
+    static thread_local std::vector<int> buffer1;
+    static thread_local std::vector<int> buffer2;
     int n;
-    
-    /// dummy layer
-    if (this->dummy_para > 0){
-      n = this->dummy_info.size();
-      w_model_x.reserve(n);
-      for (int i = 0; i != n; ++i) {
-        w_model_x.push_back(x[this->dummy_info[i]]);
-      }
-    } else {
-      w_model_x = x;
-    }
-    
-    // neutrality layer
-    if (this->neutrality_para > 0) {
-      tempX = w_model_x;
-      layer_neutrality_compute(tempX,w_model_x,this->neutrality_para);
-    } 
-    
-    // epistasis layer
-    if (this->epistasis_para > 0) {
-      tempX = w_model_x;
-      layer_epistasis_compute(tempX,w_model_x,this->epistasis_para);
-    }
+
+    const std::vector<int> &w_model_x = w_model_layers_compute(x,this->dummy_para > 0 ? &this->dummy_info : NULL,
+                                                               this->neutrality_para,this->epistasis_para,buffer1,buffer2);
     
     // base evaluate
     n = w_model_x.size();
@@ -113,6 +97,27 @@ public:
     return (double)result;
   }
 
+  bool internal_packed_supported() const {
+    return true;
+  }
+
+  double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    static thread_local std::vector<uint64_t> buffer1;
+    static thread_local std::vector<uint64_t> buffer2;
+    std::size_t length;
+
+    const uint64_t *w_model_x = w_model_layers_compute_packed(x,n,this->dummy_para > 0 ? &this->dummy_info : NULL,
+                                                              this->neutrality_para,this->epistasis_para,buffer1,buffer2,length);
+    int result = packed_count_ones(w_model_x,length);
+
+    // ruggedness layer
+    if (this->ruggedness_para > 0) {
+      result = this->ruggedness_info[result];
+    }
+
+    return (double)result;
+  }
+
   static W_Model_OneMax * createInstance(int instance_id = DEFAULT_INSTANCE, int dimension = DEFAULT_DIMENSION) {
     return new W_Model_OneMax(instance_id, dimension);
   }
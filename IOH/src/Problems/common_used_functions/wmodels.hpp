@@ -9,6 +9,7 @@
 #define _F_WMODELS_H
 
 #include "IOHprofiler_random.h"
+#include "IOHprofiler_packed_bits.h"
 
 
 static std::vector<int> dummy(int number_of_variables, double select_rate, long inseed) {
@@ -43,11 +44,48 @@ static std::vector<int> dummy(int number_of_variables, double select_rate, long
   return random_index;
 }
 
-static std::vector<int> neutrality(const std::vector<int> &variables, int mu) {
+/// \fn static void dummy_mask(const std::vector<int> &info, const int number_of_variables, std::vector<uint64_t> &mask)
+/// \brief The variables selected by dummy, as a packed bit string of number_of_variables variables.
+static void dummy_mask(const std::vector<int> &info, const int number_of_variables, std::vector<uint64_t> &mask) {
+  mask.assign(packed_words(number_of_variables),0);
+  for (std::size_t i = 0; i != info.size(); ++i) {
+    packed_set(mask.data(),info[i]);
+  }
+}
+
+/// \fn static int neutrality_count_ones(const uint64_t *x, const std::size_t n, const int mu)
+/// \brief The number of ones after the neutrality transformation of the n packed variables x.
+///
+/// Each output is the majority of a block of mu variables, computed by popcount.
+static int neutrality_count_ones(const uint64_t *x, const std::size_t n, const int mu) {
+  const std::size_t blocks = n / mu;
+  const int threshold = (mu >> 1) + (mu & 1);
+  int result = 0;
+  for (std::size_t j = 0; j != blocks; ++j) {
+    result += packed_count_ones(x,j * mu,mu) >= threshold;
+  }
+  return result;
+}
+
+/// \fn static int neutrality_leading_ones(const uint64_t *x, const std::size_t n, const int mu)
+/// \brief The number of leading ones after the neutrality transformation of the n packed variables x.
+static int neutrality_leading_ones(const uint64_t *x, const std::size_t n, const int mu) {
+  const std::size_t blocks = n / mu;
+  const int threshold = (mu >> 1) + (mu & 1);
+  std::size_t j = 0;
+  while (j != blocks && packed_count_ones(x,j * mu,mu) >= threshold) {
+    ++j;
+  }
+  return (int)j;
+}
+
+/// \fn static void neutrality(const std::vector<int> &variables, int mu, std::vector<int> &new_variables)
+/// \brief The neutrality transformation of variables, written into new_variables.
+static void neutrality(const std::vector<int> &variables, int mu, std::vector<int> &new_variables) {
   int number_of_variables = variables.size();
   int n = (int)floor((double)number_of_variables/(double)mu);
-  std::vector<int> new_variables;
 
+  new_variables.clear();
   new_variables.reserve(n);
   int i = 0, temp = 0;
   while (i != number_of_variables) {
@@ -62,54 +100,73 @@ static std::vector<int> neutrality(const std::vector<int> &variables, int mu) {
     }
     i++;
   }
+}
 
+static std::vector<int> neutrality(const std::vector<int> &variables, int mu) {
+  std::vector<int> new_variables;
+  neutrality(variables,mu,new_variables);
   return new_variables;
 }
 
-static std::vector<int> epistasis(const std::vector<int> &variables, int v) {
-  int h, epistasis_result;
+/// \fn static int block_parity(const int *x, const int size)
+/// \brief The parity of the binary variables x[0], ..., x[size - 1].
+static int block_parity(const int *x, const int size) {
+  int parity = 0;
+  for (int j = 0; j < size; ++j) {
+    parity ^= x[j];
+  }
+  return parity;
+}
+
+/// \fn static void epistasis(const std::vector<int> &variables, int v, std::vector<int> &new_variables)
+/// \brief The epistasis transformation of variables on blocks of v variables, written into new_variables.
+///
+/// The last output of a block is the parity of the block, and its i-th output is the parity
+/// without the variable at size - 1 - (size - i - 2) % 4 of the block. The parity of each block
+/// is thus computed once and each output derived from it, in O(n) overall.
+static void epistasis(const std::vector<int> &variables, int v, std::vector<int> &new_variables) {
   int number_of_variables = variables.size();
-  std::vector<int> new_variables;
-  new_variables.reserve(number_of_variables);
-  h = 0;
-  while (h + v - 1 < number_of_variables) {
-    int i = 0;
-    while(i < v) {
-      epistasis_result = -1;
-      for (int j = 0; j < v; ++j) {
-        if ((v - j - 1) != ((v - i - 1) - 1) % 4) {
-          if (epistasis_result == -1) {
-            epistasis_result = variables[h+j];
-          } else {
-            epistasis_result = (epistasis_result != variables[h+j]);
-          }
-        }
-      }
-      new_variables.push_back(epistasis_result);
-      ++i;
+  new_variables.resize(number_of_variables);
+  for (int h = 0; h < number_of_variables; h += v) {
+    const int size = std::min(v, number_of_variables - h);
+    const int *block = variables.data() + h;
+    const int parity = block_parity(block,size);
+    for (int i = 0; i < size - 1; ++i) {
+      new_variables[h + i] = parity ^ block[size - 1 - (size - i - 2) % 4];
     }
-    h += v;
+    new_variables[h + size - 1] = parity;
   }
-  if(number_of_variables - h > 0) {
-    v = number_of_variables - h;
-    int i = 0;
-    while (i < v) {
-      epistasis_result = -1;
-      for (int j = 0; j < v; ++j) {
-        if ((v - j - 1) != ((v - i - 1) - 1) % 4) {
-          if (epistasis_result == -1) {
-            epistasis_result = variables[h+j];
-          } else {
-            epistasis_result = (epistasis_result != variables[h+j]);
-          }
-        }
-      }
-      new_variables.push_back(epistasis_result);
-      ++i;
+}
+
+static std::vector<int> epistasis(const std::vector<int> &variables, int v) {
+  std::vector<int> new_variables;
+  epistasis(variables,v,new_variables);
+  return new_variables;
+}
+
+/// \fn static void epistasis_packed(const uint64_t *x, const std::size_t n, const int v, uint64_t *y)
+/// \brief The epistasis transformation of the n packed variables x on blocks of v variables, written into y.
+///
+/// The i-th output of a block is the parity of the block without its variable i + 1, and the
+/// last one is the parity of the block, as in epistasis_compute, and in epistasis for v <= 5.
+/// The parity of a block is computed by popcount, and its outputs are the block shifted by one
+/// variable and xored with the parity, word by word. The bits of y after the last variable are 0.
+static void epistasis_packed(const uint64_t *x, const std::size_t n, const int v, uint64_t *y) {
+  const std::size_t words = packed_words(n);
+  for (std::size_t w = 0; w != words; ++w) {
+    y[w] = 0;
+  }
+  for (std::size_t h = 0; h < n; h += v) {
+    const std::size_t end = std::min(h + v, n);
+    const uint64_t parity = (packed_count_ones(x,h,end - h) & 1) ? ~(uint64_t)0 : 0;
+    for (std::size_t i = h; i != end; ) {
+      const std::size_t size = std::min((std::size_t)64, end - i);
+      const std::size_t shifted = std::min(size, end - (i + 1));
+      const uint64_t bits = shifted != 0 ? packed_extract(x,i + 1,shifted) : 0;
+      packed_deposit(y,i,size,bits ^ parity);
+      i += size;
     }
-    h += v;
   }
-  return new_variables;
 }
 
 static double ruggedness1(double y, int number_of_variables) {
@@ -194,23 +251,15 @@ static void layer_neutrality_compute(const std::vector<int> &xIn, std::vector<in
   }
 }
 
+/// The i-th output of the block [start, end] is the parity of the block without xIn[i + 1],
+/// and the last one is the parity of the block, so each output is derived from the parity in O(1).
 static void base_epistasis(const std::vector<int> &xIn, const int start, const int nu, std::vector<int> &xOut) {
   const int end = (start + nu) - 1;
-  const int flip = xIn[start];
-  int result;
-  int skip = start;
-  for (int i = end ; i >= start; --i) {
-    result = flip;
-    for (int j = end; j > start; --j) {
-      if (j != skip) {
-        result ^= (xIn[j]);
-      }
-    }
-    xOut[i] = result;
-    if ((--skip) < start) {
-      skip = end;
-    }
+  const int parity = block_parity(xIn.data() + start,nu);
+  for (int i = start; i < end; ++i) {
+    xOut[i] = parity ^ xIn[i + 1];
   }
+  xOut[end] = parity;
 }
 
 static void epistasis_compute(const std::vector<int>  &xIn, std::vector<int> &xOut, const int nu) {
@@ -229,6 +278,95 @@ static void layer_epistasis_compute(const std::vector<int> &x, std::vector<int>
   epistasis_compute(x,epistasis_x,block_size);
 }
 
+/// \fn static const std::vector<int> &w_model_layers_compute(const std::vector<int> &x, const std::vector<int> *dummy_info, const int neutrality_para, const int epistasis_para, std::vector<int> &buffer1, std::vector<int> &buffer2)
+/// \brief Applies the dummy (if dummy_info is not null), neutrality and epistasis layers to x.
+///
+/// Each layer writes its result into the buffer its input is not in. As the buffers are only
+/// resized, they are not reallocated when they are reused for solutions of the same size.
+/// \return The result, which is x itself if no layer is applied.
+static const std::vector<int> &w_model_layers_compute(const std::vector<int> &x, const std::vector<int> *dummy_info,
+                                                      const int neutrality_para, const int epistasis_para,
+                                                      std::vector<int> &buffer1, std::vector<int> &buffer2) {
+  const std::vector<int> *w_model_x = &x;
+
+  // dummy layer
+  if (dummy_info != NULL) {
+    const int n = dummy_info->size();
+    buffer1.resize(n);
+    for (int i = 0; i != n; ++i) {
+      buffer1[i] = x[(*dummy_info)[i]];
+    }
+    w_model_x = &buffer1;
+  }
+
+  // neutrality layer
+  if (neutrality_para > 0) {
+    std::vector<int> &out = (w_model_x == &buffer1) ? buffer2 : buffer1;
+    layer_neutrality_compute(*w_model_x,out,neutrality_para);
+    w_model_x = &out;
+  }
+
+  // epistasis layer
+  if (epistasis_para > 0) {
+    std::vector<int> &out = (w_model_x == &buffer1) ? buffer2 : buffer1;
+    out.resize(w_model_x->size());
+    layer_epistasis_compute(*w_model_x,out,epistasis_para);
+    w_model_x = &out;
+  }
+  return *w_model_x;
+}
+
+/// \fn static const uint64_t *w_model_layers_compute_packed(const uint64_t *x, const std::size_t n, const std::vector<int> *dummy_info, const int neutrality_para, const int epistasis_para, std::vector<uint64_t> &buffer1, std::vector<uint64_t> &buffer2, std::size_t &length)
+/// \brief Applies the layers of w_model_layers_compute to the n packed variables x.
+///
+/// The dummy layer gathers the selected variables, the neutrality layer takes the majority of
+/// each block by popcount, and the epistasis layer is epistasis_packed. The bits after the last
+/// variable of the result are 0 if those of x are.
+/// \return The result, of length variables, which is x itself if no layer is applied.
+static const uint64_t *w_model_layers_compute_packed(const uint64_t *x, const std::size_t n, const std::vector<int> *dummy_info,
+                                                     const int neutrality_para, const int epistasis_para,
+                                                     std::vector<uint64_t> &buffer1, std::vector<uint64_t> &buffer2,
+                                                     std::size_t &length) {
+  const uint64_t *w_model_x = x;
+  length = n;
+
+  // dummy layer
+  if (dummy_info != NULL) {
+    length = dummy_info->size();
+    buffer1.assign(packed_words(length),0);
+    for (std::size_t i = 0; i != length; ++i) {
+      if (packed_get(x,(*dummy_info)[i])) {
+        packed_set(buffer1.data(),i);
+      }
+    }
+    w_model_x = buffer1.data();
+  }
+
+  // neutrality layer
+  if (neutrality_para > 0) {
+    std::vector<uint64_t> &out = (w_model_x == buffer1.data()) ? buffer2 : buffer1;
+    const std::size_t blocks = length / neutrality_para;
+    const int threshold = (neutrality_para >> 1) + (neutrality_para & 1);
+    out.assign(packed_words(blocks),0);
+    for (std::size_t j = 0; j != blocks; ++j) {
+      if (packed_count_ones(w_model_x,j * neutrality_para,neutrality_para) >= threshold) {
+        packed_set(out.data(),j);
+      }
+    }
+    w_model_x = out.data();
+    length = blocks;
+  }
+
+  // epistasis layer
+  if (epistasis_para > 0) {
+    std::vector<uint64_t> &out = (w_model_x == buffer1.data()) ? buffer2 : buffer1;
+    out.resize(packed_words(length));
+    epistasis_packed(w_model_x,length,epistasis_para,out.data());
+    w_model_x = out.data();
+  }
+  return w_model_x;
+}
+
 static int max_gamma(int q) {
     return (int)((q * (q - 1))>>1);
 }
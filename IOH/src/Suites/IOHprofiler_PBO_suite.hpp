@@ -59,7 +59,8 @@ public:
     this->loadProblem();
   }
 
-  PBO_suite(std::vector<int> problem_id, std::vector<int> instance_id, std::vector<int> dimension) {
+  /// \param lazy_load whether the problems are created when they are requested, see IOHprofiler_set_lazy_load_flag.
+  PBO_suite(std::vector<int> problem_id, std::vector<int> instance_id, std::vector<int> dimension, const bool lazy_load = false) {
     for (size_t i = 0; i < problem_id.size(); ++i) {
       if (problem_id[i] < 0 || problem_id[i] > 23) {
         IOH_error("problem_id " + std::to_string(problem_id[i]) + " is not in PBO_suite");
@@ -82,6 +83,7 @@ public:
     IOHprofiler_set_suite_instance_id(instance_id);
     IOHprofiler_set_suite_dimension(dimension);
     IOHprofiler_set_suite_name("PBO");
+    IOHprofiler_set_lazy_load_flag(lazy_load);
     this->registerProblem();
     this->loadProblem();
   }
@@ -10,17 +10,32 @@
 
 #include "IOHprofiler_common.h"
 
+#include <memory>
+#include <mutex>
+
 typedef std::string defaultIDKeyType;
 
 template <class manufacturedObj> class genericGenerator {
   
   /// typedef std::shared_ptr<manufacturedObj> (*BASE_CREATE_FN)() ;
-  
+
+  /// The functions creating a class, with the default arguments or for an instance and a
+  /// dimension. The latter is null if the class does not support it.
+  struct FN_entry {
+    std::shared_ptr<manufacturedObj> (*create)();
+    std::shared_ptr<manufacturedObj> (*create_instance)(int, int);
+  };
+
   /// FN_REGISTRY is the registry of all the BASE_CREATE_FN
   /// pointers registered.  Functions are registered using the
   /// regCreateFn member function (see below).
-  typedef  std::map<std::string, std::shared_ptr<manufacturedObj> (*)()> FN_registry;
-  FN_registry registry;
+  typedef  std::map<std::string, FN_entry> FN_registry;
+
+  /// The current registry, which is never modified once published. A registration publishes
+  /// a modified copy with std::atomic_store, so create() reads the registry without locking.
+  /// A previous registry is released once the last create() reading it returns.
+  std::shared_ptr<const FN_registry> registry;
+  std::mutex registration_mutex; /// < serializes the registrations.
 
   genericGenerator();
   genericGenerator(const genericGenerator&) = delete; 
@@ -34,14 +49,29 @@ public:
   ///
   /// Classes derived from manufacturedObj call this function once
   /// per program to register the class ID key, and a pointer to
-  /// the function that creates the class.
+  /// the function that creates the class. Registering a class again with the same
+  /// functions, as the suites do when they are constructed, does not change the registry.
   void regCreateFn(std::string, std::shared_ptr<manufacturedObj> (*)());
+
+  /// \fn regCreateFn(std::string, std::shared_ptr<manufacturedObj> (*)(), std::shared_ptr<manufacturedObj> (*)(int, int));
+  ///
+  /// Registers also the function creating the class for an instance and a dimension.
+  void regCreateFn(std::string, std::shared_ptr<manufacturedObj> (*)(), std::shared_ptr<manufacturedObj> (*)(int, int));
   
   /// \fn std::shared_ptr<manufacturedObj> create(std::string className) const;
   ///
   /// Create a new class of the type specified by className.
   /// The create function simple looks up the class ID, and if it's in the list, the statement "(*i).second();" calls the function.
+  /// It can be called by several threads at the same time, also during registrations.
   std::shared_ptr<manufacturedObj> create(std::string className) const;
+
+  /// \fn std::shared_ptr<manufacturedObj> create(std::string className, int instance_id, int dimension) const;
+  ///
+  /// Create a new class of the type specified by className for the given instance and dimension,
+  /// so that a problem is prepared once for them, instead of being prepared for the default
+  /// instance and dimension and then for each of the setters. Returns nullptr if the class was
+  /// registered without such a function.
+  std::shared_ptr<manufacturedObj> create(std::string className, int instance_id, int dimension) const;
 };
 
 /// Helper template to make registration simple.
@@ -53,6 +83,10 @@ public:
     static std::shared_ptr<ancestorType> createInstance() {
         return std::shared_ptr<ancestorType>(manufacturedObj::createInstance());
     }
+
+    static std::shared_ptr<ancestorType> createInstance(int instance_id, int dimension) {
+        return std::shared_ptr<ancestorType>(manufacturedObj::createInstance(instance_id, dimension));
+    }
     
     /// \fn registerInFactory(const classIDKey id)
     /// \brief Register the creation function.  
@@ -60,10 +94,24 @@ public:
     /// This simply associates the classIDKey with the function used to create the class.  
     /// The return value is a dummy value, which is used to allow static initialization of the registry.
     registerInFactory(const classIDKey id) {
-      genericGenerator<ancestorType>::instance().regCreateFn(id, createInstance);
+      std::shared_ptr<ancestorType> (*create)() = createInstance;
+      genericGenerator<ancestorType>::instance().regCreateFn(id, create, instance_creator<manufacturedObj>(0));
+    }
+
+private:
+    /// The function creating the class for an instance and a dimension, if the class has
+    /// createInstance(instance_id, dimension) as the problems do, otherwise nullptr.
+    template <class T>
+    static auto instance_creator(int) -> decltype(T::createInstance(0, 0), static_cast<std::shared_ptr<ancestorType> (*)(int, int)>(nullptr)) {
+      return createInstance;
+    }
+
+    template <class T>
+    static std::shared_ptr<ancestorType> (*instance_creator(long))(int, int) {
+      return nullptr;
     }
 };
 
 #include "IOHprofiler_class_generator.hpp"
 
-#endif
\ No newline at end of file
+#endif
@@ -1,24 +1,53 @@
 template <class manufacturedObj> genericGenerator<manufacturedObj>::genericGenerator() {
+  this->registry = std::make_shared<const FN_registry>();
 }
 
 template <class manufacturedObj> genericGenerator<manufacturedObj> &genericGenerator<manufacturedObj>::instance() {
-    /// Note that this is not thread-safe!
+    /// The initialization of a local static is thread-safe.
     static genericGenerator theInstance;
     return theInstance;
 }
 
 template <class manufacturedObj> void genericGenerator<manufacturedObj>::regCreateFn(std::string clName, std::shared_ptr<manufacturedObj> (*func)()) {
-  registry[clName]=func;
+  this->regCreateFn(clName, func, nullptr);
+}
+
+template <class manufacturedObj> void genericGenerator<manufacturedObj>::regCreateFn(std::string clName, std::shared_ptr<manufacturedObj> (*func)(), std::shared_ptr<manufacturedObj> (*instance_func)(int, int)) {
+  std::lock_guard<std::mutex> lock(this->registration_mutex);
+  const std::shared_ptr<const FN_registry> current = std::atomic_load(&this->registry);
+  typename FN_registry::const_iterator regEntry = current->find(clName);
+  if (regEntry != current->end() && (*regEntry).second.create == func && (*regEntry).second.create_instance == instance_func) {
+    return;
+  }
+
+  std::shared_ptr<FN_registry> updated = std::make_shared<FN_registry>(*current);
+  FN_entry entry = {func, instance_func};
+  (*updated)[clName] = entry;
+  std::atomic_store(&this->registry, std::shared_ptr<const FN_registry>(updated));
 }
 
 template <class manufacturedObj> std::shared_ptr<manufacturedObj> genericGenerator<manufacturedObj>::create(std::string className) const {
   std::shared_ptr<manufacturedObj> ret(nullptr);
 
-  typename FN_registry::const_iterator regEntry = registry.find(className);
-  if (regEntry != registry.end()) {
-    return (*regEntry).second();
+  const std::shared_ptr<const FN_registry> current = std::atomic_load(&this->registry);
+  typename FN_registry::const_iterator regEntry = current->find(className);
+  if (regEntry != current->end()) {
+    return (*regEntry).second.create();
   } else {
     IOH_error("Object unknown in the registry");
   }
   return ret;
 }
+
+template <class manufacturedObj> std::shared_ptr<manufacturedObj> genericGenerator<manufacturedObj>::create(std::string className, int instance_id, int dimension) const {
+  std::shared_ptr<manufacturedObj> ret(nullptr);
+
+  const std::shared_ptr<const FN_registry> current = std::atomic_load(&this->registry);
+  typename FN_registry::const_iterator regEntry = current->find(className);
+  if (regEntry == current->end()) {
+    IOH_error("Object unknown in the registry");
+  } else if ((*regEntry).second.create_instance != nullptr) {
+    return (*regEntry).second.create_instance(instance_id, dimension);
+  }
+  return ret;
+}
@@ -0,0 +1,123 @@
+/// \file IOHprofiler_evaluation_state.h
+/// \brief Header file for class IOHprofiler_evaluation_state.
+///
+/// \author Furong Ye
+#ifndef _IOHPROFILER_EVALUATION_STATE_H
+#define _IOHPROFILER_EVALUATION_STATE_H
+
+#include "IOHprofiler_common.h"
+
+/// \brief The bookkeeping of a run on a problem.
+///
+/// The number of evaluations, the last objectives and the best-so-far information of a
+/// run. It is kept apart from the data of the problem instance, so that an instance can
+/// be shared by several runs, each recording its evaluations in its own state.
+class IOHprofiler_evaluation_state {
+public:
+  IOHprofiler_evaluation_state(const std::size_t number_of_objectives = 1) :
+    evaluations(0),
+    raw_objectives(std::vector<double>(number_of_objectives)),
+    transformed_objectives(std::vector<double>(number_of_objectives)),
+    best_so_far_raw_objectives(std::vector<double>(number_of_objectives)),
+    best_so_far_raw_evaluations(0),
+    best_so_far_transformed_objectives(std::vector<double>(number_of_objectives)),
+    best_so_far_transformed_evaluations(0),
+    optimalFound(false) {}
+
+  /// \fn void reset(const std::size_t number_of_objectives, const IOH_optimization_type maximization_minimization_flag)
+  ///
+  /// Resets the state as before the first evaluation of a run.
+  void reset(const std::size_t number_of_objectives, const IOH_optimization_type maximization_minimization_flag) {
+    this->evaluations = 0;
+    this->best_so_far_raw_evaluations = 0;
+    this->best_so_far_transformed_evaluations = 0;
+    this->optimalFound = false;
+    this->raw_objectives.resize(number_of_objectives);
+    this->transformed_objectives.resize(number_of_objectives);
+    this->reset_best_so_far(number_of_objectives,maximization_minimization_flag);
+  }
+
+  /// \fn void reset_best_so_far(const std::size_t number_of_objectives, const IOH_optimization_type maximization_minimization_flag)
+  ///
+  /// Sets the best-so-far objectives to the worst possible value.
+  void reset_best_so_far(const std::size_t number_of_objectives, const IOH_optimization_type maximization_minimization_flag) {
+    const double worst = (maximization_minimization_flag == IOH_optimization_type::Maximization)
+                         ? std::numeric_limits<double>::lowest() : std::numeric_limits<double>::max();
+    this->best_so_far_raw_objectives.assign(number_of_objectives,worst);
+    this->best_so_far_transformed_objectives.assign(number_of_objectives,worst);
+  }
+
+  /// \fn double record(const double raw_objective, const double transformed_objective, const std::vector<double> &optimal, const IOH_optimization_type maximization_minimization_flag)
+  ///
+  /// Records an evaluation with the given objectives.
+  /// \return The transformed objective.
+  double record(const double raw_objective, const double transformed_objective, const std::vector<double> &optimal,
+                const IOH_optimization_type maximization_minimization_flag) {
+    assert(this->raw_objectives.size() >= 1);
+    assert(this->transformed_objectives.size() == this->raw_objectives.size());
+
+    ++this->evaluations;
+
+    this->raw_objectives[0] = raw_objective;
+    this->transformed_objectives[0] = transformed_objective;
+
+    if (this->raw_objectives.size() == 1 && optimal.size() == 1) {
+      /// the best-so-far information of single-objective problems is tracked in scalars
+      const bool improved = (maximization_minimization_flag == IOH_optimization_type::Maximization)
+                            ? transformed_objective > this->best_so_far_transformed_objectives[0]
+                            : transformed_objective < this->best_so_far_transformed_objectives[0];
+      if (improved) {
+        this->best_so_far_transformed_objectives[0] = transformed_objective;
+        this->best_so_far_transformed_evaluations = this->evaluations;
+        this->best_so_far_raw_objectives[0] = raw_objective;
+        this->best_so_far_raw_evaluations = this->evaluations;
+      }
+      if (transformed_objective == optimal[0]) {
+        this->optimalFound = true;
+      }
+      return transformed_objective;
+    }
+
+    if (compareObjectives(this->transformed_objectives,this->best_so_far_transformed_objectives,maximization_minimization_flag)) {
+      this->best_so_far_transformed_objectives = this->transformed_objectives;
+      this->best_so_far_transformed_evaluations = this->evaluations;
+      this->best_so_far_raw_objectives = this->raw_objectives;
+      this->best_so_far_raw_evaluations = this->evaluations;
+    }
+
+    if (compareVector(this->transformed_objectives,optimal)) {
+      this->optimalFound = true;
+    }
+
+    return this->transformed_objectives[0];
+  }
+
+  /// \fn std::vector<double> loggerInfo() const
+  ///
+  /// Return a vector logger_info may be used by loggers.
+  /// logger_info[0] evaluations
+  /// logger_info[1] raw_objectives
+  /// logger_info[2] best_so_far_raw_objectives
+  /// logger_info[3] transformed_objective
+  /// logger_info[4] best_so_far_transformed_objectives
+  std::vector<double> loggerInfo() const {
+    std::vector<double> logger_info(5);
+    logger_info[0] = (double)this->evaluations;
+    logger_info[1] = this->raw_objectives[0];
+    logger_info[2] = this->best_so_far_raw_objectives[0];
+    logger_info[3] = this->transformed_objectives[0];
+    logger_info[4] = this->best_so_far_transformed_objectives[0];
+    return logger_info;
+  }
+
+  std::size_t evaluations; /// < to record optimization process.
+  std::vector<double> raw_objectives; /// < to record objectives before transformation.
+  std::vector<double> transformed_objectives; /// < to record objectives after transformation.
+  std::vector<double> best_so_far_raw_objectives; /// < to record optimization process.
+  int best_so_far_raw_evaluations; /// < to record optimization process.
+  std::vector<double> best_so_far_transformed_objectives; /// < to record optimization process.
+  int best_so_far_transformed_evaluations; /// < to record optimization process.
+  bool optimalFound;
+};
+
+#endif // _IOHPROFILER_EVALUATION_STATE_H
@@ -0,0 +1,76 @@
+/// \file IOHprofiler_evaluator.h
+/// \brief Header file for the template class IOHprofiler_evaluator.
+///
+/// \author Furong Ye
+#ifndef _IOHPROFILER_EVALUATOR_H
+#define _IOHPROFILER_EVALUATOR_H
+
+#include "IOHprofiler_problem.h"
+
+/// \brief A run on a problem instance shared with other runs.
+///
+/// The data of a problem instance (tables, optimum, transformations) are only read by
+/// evaluations, while the number of evaluations and the best-so-far information belong
+/// to a run. An evaluator refers to a prepared problem and records the evaluations of one
+/// run in its own IOHprofiler_evaluation_state. Any number of evaluators may evaluate the
+/// same problem on different threads, as far as internal_evaluate does not modify the
+/// problem (see IOHprofiler_problem::evaluate_detached). Each evaluator is to be used by
+/// one thread at a time.
+template <class InputType> class IOHprofiler_evaluator
+{
+public:
+  /// \fn IOHprofiler_evaluator(std::shared_ptr<IOHprofiler_problem<InputType> > problem)
+  ///
+  /// The instance of the problem is updated, which is not thread-safe, so the evaluators of a
+  /// problem are to be created before they are used concurrently.
+  IOHprofiler_evaluator(std::shared_ptr<IOHprofiler_problem<InputType> > problem);
+
+  ~IOHprofiler_evaluator() {}
+
+  /// \fn double evaluate(const std::vector<InputType> &x)
+  /// \brief Evaluates x on the problem and records the evaluation in the run.
+  /// \return The transformed objective.
+  double evaluate(const std::vector<InputType> &x);
+
+  /// \fn double record_evaluation(const double raw_objective, const double transformed_objective)
+  /// \brief Recording an evaluation computed by IOHprofiler_problem::evaluate_detached.
+  /// \return The transformed objective.
+  double record_evaluation(const double raw_objective, const double transformed_objective);
+
+  /// \fn void reset()
+  /// \brief Starts a new run on the problem.
+  void reset();
+
+  std::shared_ptr<IOHprofiler_problem<InputType> > IOHprofiler_get_problem() const;
+
+  /// \fn std::vector<double> loggerInfo() const
+  ///
+  /// The information of the last evaluation, as IOHprofiler_problem::loggerInfo().
+  std::vector<double> loggerInfo() const;
+
+  bool IOHprofiler_hit_optimal() const;
+
+  int IOHprofiler_get_evaluations() const;
+
+  std::vector<double> IOHprofiler_get_raw_objectives() const;
+
+  std::vector<double> IOHprofiler_get_transformed_objectives() const;
+
+  std::vector<double> IOHprofiler_get_best_so_far_raw_objectives() const;
+
+  int IOHprofiler_get_best_so_far_raw_evaluations() const;
+
+  std::vector<double> IOHprofiler_get_best_so_far_transformed_objectives() const;
+
+  int IOHprofiler_get_best_so_far_transformed_evaluations() const;
+
+private:
+  std::shared_ptr<IOHprofiler_problem<InputType> > problem; /// < the shared problem instance.
+  IOHprofiler_evaluation_state evaluation_state; /// < the bookkeeping of the run.
+  std::vector<double> optimal; /// < the optimum of the problem instance.
+  IOH_optimization_type maximization_minimization_flag;
+};
+
+#include "IOHprofiler_evaluator.hpp"
+
+#endif // _IOHPROFILER_EVALUATOR_H
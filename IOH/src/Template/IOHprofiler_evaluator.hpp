@@ -0,0 +1,63 @@
+
+template <class InputType> IOHprofiler_evaluator<InputType>::IOHprofiler_evaluator(std::shared_ptr<IOHprofiler_problem<InputType> > problem) :
+  problem(problem),
+  evaluation_state(problem->IOHprofiler_get_number_of_objectives()) {
+  this->reset();
+}
+
+template <class InputType> double IOHprofiler_evaluator<InputType>::evaluate(const std::vector<InputType> &x) {
+  double raw_objective;
+  const double transformed_objective = this->problem->evaluate_detached(x,raw_objective);
+  return this->record_evaluation(raw_objective,transformed_objective);
+}
+
+template <class InputType> double IOHprofiler_evaluator<InputType>::record_evaluation(const double raw_objective, const double transformed_objective) {
+  return this->evaluation_state.record(raw_objective,transformed_objective,this->optimal,this->maximization_minimization_flag);
+}
+
+template <class InputType> void IOHprofiler_evaluator<InputType>::reset() {
+  this->problem->update_instance();
+  this->optimal = this->problem->IOHprofiler_get_optimal();
+  this->maximization_minimization_flag = this->problem->IOHprofiler_get_optimization_type();
+  this->evaluation_state.reset(this->problem->IOHprofiler_get_number_of_objectives(),this->maximization_minimization_flag);
+}
+
+template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHprofiler_evaluator<InputType>::IOHprofiler_get_problem() const {
+  return this->problem;
+}
+
+template <class InputType> std::vector<double> IOHprofiler_evaluator<InputType>::loggerInfo() const {
+  return this->evaluation_state.loggerInfo();
+}
+
+template <class InputType> bool IOHprofiler_evaluator<InputType>::IOHprofiler_hit_optimal() const {
+  return this->evaluation_state.optimalFound;
+}
+
+template <class InputType> int IOHprofiler_evaluator<InputType>::IOHprofiler_get_evaluations() const {
+  return this->evaluation_state.evaluations;
+}
+
+template <class InputType> std::vector<double> IOHprofiler_evaluator<InputType>::IOHprofiler_get_raw_objectives() const {
+  return this->evaluation_state.raw_objectives;
+}
+
+template <class InputType> std::vector<double> IOHprofiler_evaluator<InputType>::IOHprofiler_get_transformed_objectives() const {
+  return this->evaluation_state.transformed_objectives;
+}
+
+template <class InputType> std::vector<double> IOHprofiler_evaluator<InputType>::IOHprofiler_get_best_so_far_raw_objectives() const {
+  return this->evaluation_state.best_so_far_raw_objectives;
+}
+
+template <class InputType> int IOHprofiler_evaluator<InputType>::IOHprofiler_get_best_so_far_raw_evaluations() const {
+  return this->evaluation_state.best_so_far_raw_evaluations;
+}
+
+template <class InputType> std::vector<double> IOHprofiler_evaluator<InputType>::IOHprofiler_get_best_so_far_transformed_objectives() const {
+  return this->evaluation_state.best_so_far_transformed_objectives;
+}
+
+template <class InputType> int IOHprofiler_evaluator<InputType>::IOHprofiler_get_best_so_far_transformed_evaluations() const {
+  return this->evaluation_state.best_so_far_transformed_evaluations;
+}
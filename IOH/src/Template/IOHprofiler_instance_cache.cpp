@@ -0,0 +1,157 @@
+/// \file IOHprofiler_instance_cache.cpp
+/// \brief Cpp file for class IOHprofiler_instance_cache.
+///
+/// \author Furong Ye
+
+#include "IOHprofiler_instance_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#if defined(_WIN32) || defined(_WIN64) || defined(__MINGW64__) || defined(__CYGWIN__)
+  #include <process.h>
+  #define IOHPROFILER_INSTANCE_CACHE_PID _getpid()
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #define IOHPROFILER_INSTANCE_CACHE_MMAP
+  #define IOHPROFILER_INSTANCE_CACHE_PID getpid()
+#endif
+
+namespace {
+
+/// The header of a cache file, followed by count doubles.
+struct instance_cache_header {
+  char magic[4];
+  uint32_t version;
+  uint64_t count;
+};
+
+const char instance_cache_magic[4] = {'I', 'O', 'H', 'C'};
+
+bool valid_header(const instance_cache_header &header, const std::size_t file_size) {
+  return std::memcmp(header.magic, instance_cache_magic, sizeof(instance_cache_magic)) == 0 &&
+         header.version == IOHPROFILER_INSTANCE_CACHE_VERSION &&
+         header.count == (file_size - sizeof(instance_cache_header)) / sizeof(double) &&
+         (file_size - sizeof(instance_cache_header)) % sizeof(double) == 0;
+}
+
+struct instance_cache_directory {
+  instance_cache_directory() {
+    const char *directory = std::getenv("IOH_INSTANCE_CACHE");
+    if (directory != NULL) {
+      this->path = directory;
+    }
+  }
+
+  std::mutex mutex;
+  std::string path;
+};
+
+instance_cache_directory &cache_directory() {
+  static instance_cache_directory directory;
+  return directory;
+}
+
+}
+
+void IOHprofiler_instance_cache::set_directory(const std::string &directory) {
+  instance_cache_directory &cache = cache_directory();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.path = directory;
+}
+
+std::string IOHprofiler_instance_cache::get_directory() {
+  instance_cache_directory &cache = cache_directory();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.path;
+}
+
+std::string IOHprofiler_instance_cache::file_name(const std::string &directory, const std::string &key) {
+  return directory + IOHprofiler_path_separator + key + ".bin";
+}
+
+bool IOHprofiler_instance_cache::load(const std::string &key, std::vector<double> &data) {
+  const std::string directory = get_directory();
+  if (directory.empty()) {
+    return false;
+  }
+  const std::string name = file_name(directory, key);
+
+#ifdef IOHPROFILER_INSTANCE_CACHE_MMAP
+  const int fd = open(name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat status;
+  if (fstat(fd, &status) != 0 || (std::size_t)status.st_size < sizeof(instance_cache_header)) {
+    close(fd);
+    return false;
+  }
+  const std::size_t file_size = (std::size_t)status.st_size;
+  void *mapping = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  const instance_cache_header *header = static_cast<const instance_cache_header *>(mapping);
+  const bool valid = valid_header(*header, file_size);
+  if (valid) {
+    const double *values = reinterpret_cast<const double *>(header + 1);
+    data.assign(values, values + header->count);
+  }
+  munmap(mapping, file_size);
+  return valid;
+#else
+  std::ifstream file(name.c_str(), std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+  const std::size_t file_size = (std::size_t)file.tellg();
+  instance_cache_header header;
+  if (file_size < sizeof(header) || !file.seekg(0).read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      !valid_header(header, file_size)) {
+    return false;
+  }
+  data.resize(header.count);
+  return (bool)file.read(reinterpret_cast<char *>(data.data()), header.count * sizeof(double));
+#endif
+}
+
+void IOHprofiler_instance_cache::store(const std::string &key, const std::vector<double> &data) {
+  const std::string directory = get_directory();
+  if (directory.empty()) {
+    return;
+  }
+  const std::string name = file_name(directory, key);
+  std::ostringstream temporary;
+  temporary << name << ".tmp" << IOHPROFILER_INSTANCE_CACHE_PID << "_" << std::hash<std::thread::id>()(std::this_thread::get_id());
+
+  instance_cache_header header;
+  std::memcpy(header.magic, instance_cache_magic, sizeof(instance_cache_magic));
+  header.version = IOHPROFILER_INSTANCE_CACHE_VERSION;
+  header.count = data.size();
+
+  {
+    std::ofstream file(temporary.str().c_str(), std::ios::binary | std::ios::trunc);
+    if (!file) {
+      IOH_warning("Instance cache: can not write " + temporary.str());
+      return;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(double));
+    if (!file) {
+      file.close();
+      std::remove(temporary.str().c_str());
+      IOH_warning("Instance cache: can not write " + temporary.str());
+      return;
+    }
+  }
+  /// another process may have stored the same data in the meantime, which is fine.
+  if (std::rename(temporary.str().c_str(), name.c_str()) != 0) {
+    std::remove(temporary.str().c_str());
+  }
+}
@@ -0,0 +1,49 @@
+/// \file IOHprofiler_instance_cache.h
+/// \brief Header file for class IOHprofiler_instance_cache.
+///
+/// \author Furong Ye
+#ifndef _IOHPROFILER_INSTANCE_CACHE_H
+#define _IOHPROFILER_INSTANCE_CACHE_H
+
+#include "IOHprofiler_common.h"
+
+/// The version of the file format, stored in the header of each file. Files of other
+/// versions are ignored and written again.
+#define IOHPROFILER_INSTANCE_CACHE_VERSION 1
+
+/// \brief An optional on-disk cache of expensive instance data.
+///
+/// Tables that are generated deterministically for a (problem, instance, dimension), such
+/// as rotation matrices, are written once into a binary file of the cache directory and
+/// loaded by later processes with a read-only memory mapping, instead of being generated
+/// again. The cache is disabled unless a directory is set, either by set_directory() or
+/// by the environment variable IOH_INSTANCE_CACHE.
+///
+/// The values are stored bitwise, so that loaded tables equal generated ones. A file is
+/// written to a temporary name and renamed, so that concurrent processes never read a
+/// partial file.
+class IOHprofiler_instance_cache {
+public:
+  /// \fn static void set_directory(const std::string &directory)
+  ///
+  /// Sets the directory of the cache, which must exist. An empty directory disables the cache.
+  static void set_directory(const std::string &directory);
+
+  static std::string get_directory();
+
+  /// \fn static bool load(const std::string &key, std::vector<double> &data)
+  ///
+  /// Loads the data stored with the key.
+  /// \return false if the cache is disabled or has no valid data for the key.
+  static bool load(const std::string &key, std::vector<double> &data);
+
+  /// \fn static void store(const std::string &key, const std::vector<double> &data)
+  ///
+  /// Stores the data with the key, if the cache is enabled.
+  static void store(const std::string &key, const std::vector<double> &data);
+
+private:
+  static std::string file_name(const std::string &directory, const std::string &key);
+};
+
+#endif // _IOHPROFILER_INSTANCE_CACHE_H
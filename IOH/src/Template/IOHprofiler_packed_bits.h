@@ -0,0 +1,141 @@
+/// \file IOHprofiler_packed_bits.h
+/// \brief Header file for the functions on packed bit strings.
+///
+/// A bit string of n variables is packed into (n + 63) / 64 words of 64 bits, where variable i
+/// is bit i % 64 of word i / 64. Unless stated otherwise, the bits after the last variable
+/// must be 0.
+///
+/// \author Furong Ye
+#ifndef _IOHPROFILER_PACKED_BITS_H
+#define _IOHPROFILER_PACKED_BITS_H
+
+#include <cstddef>
+#include <stdint.h>
+
+/// \fn std::size_t packed_words(const std::size_t n)
+/// \brief The number of words of a packed bit string of n variables.
+static inline std::size_t packed_words(const std::size_t n) {
+  return (n + 63) / 64;
+}
+
+/// \fn uint64_t packed_low_mask(const std::size_t size)
+/// \brief The word whose size lowest bits are set, for size <= 64.
+static inline uint64_t packed_low_mask(const std::size_t size) {
+  return size >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << size) - 1);
+}
+
+/// \fn uint64_t packed_tail_mask(const std::size_t n)
+/// \brief The bits of the last word of a packed bit string of n > 0 variables which hold variables.
+static inline uint64_t packed_tail_mask(const std::size_t n) {
+  return packed_low_mask(n - (packed_words(n) - 1) * 64);
+}
+
+/// \fn int packed_popcount(const uint64_t word)
+/// \brief The number of bits set in word.
+static inline int packed_popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(word);
+#else
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return (int)((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/// \fn int packed_count_trailing_zeros(const uint64_t word)
+/// \brief The index of the lowest bit set in word, which must not be 0.
+static inline int packed_count_trailing_zeros(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  return packed_popcount((word & (0 - word)) - 1);
+#endif
+}
+
+/// \fn int packed_get(const uint64_t *x, const std::size_t i)
+/// \brief Variable i of x.
+static inline int packed_get(const uint64_t *x, const std::size_t i) {
+  return (int)((x[i >> 6] >> (i & 63)) & 1);
+}
+
+/// \fn void packed_set(uint64_t *x, const std::size_t i)
+/// \brief Setting variable i of x to 1.
+static inline void packed_set(uint64_t *x, const std::size_t i) {
+  x[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+/// \fn uint64_t packed_extract(const uint64_t *x, const std::size_t position, const std::size_t size)
+/// \brief The variables [position, position + size) of x as the lowest bits of a word, for size <= 64.
+///
+/// The variables may straddle two words.
+static inline uint64_t packed_extract(const uint64_t *x, const std::size_t position, const std::size_t size) {
+  const std::size_t word = position >> 6;
+  const std::size_t offset = position & 63;
+  uint64_t bits = x[word] >> offset;
+  if (offset + size > 64) {
+    bits |= x[word + 1] << (64 - offset);
+  }
+  return bits & packed_low_mask(size);
+}
+
+/// \fn void packed_deposit(uint64_t *x, const std::size_t position, const std::size_t size, const uint64_t bits)
+/// \brief Writing the size lowest bits of bits into the variables [position, position + size) of x, for size <= 64.
+static inline void packed_deposit(uint64_t *x, const std::size_t position, const std::size_t size, uint64_t bits) {
+  const std::size_t word = position >> 6;
+  const std::size_t offset = position & 63;
+  const uint64_t mask = packed_low_mask(size);
+  bits &= mask;
+  x[word] = (x[word] & ~(mask << offset)) | (bits << offset);
+  if (offset + size > 64) {
+    x[word + 1] = (x[word + 1] & ~(mask >> (64 - offset))) | (bits >> (64 - offset));
+  }
+}
+
+/// \fn int packed_count_ones(const uint64_t *x, const std::size_t n)
+/// \brief The number of ones of x, by popcount over its words.
+static inline int packed_count_ones(const uint64_t *x, const std::size_t n) {
+  const std::size_t words = packed_words(n);
+  int result = 0;
+  for (std::size_t w = 0; w != words; ++w) {
+    result += packed_popcount(x[w]);
+  }
+  return result;
+}
+
+/// \fn int packed_count_ones(const uint64_t *x, const std::size_t position, const std::size_t size)
+/// \brief The number of ones of the variables [position, position + size) of x.
+static inline int packed_count_ones(const uint64_t *x, const std::size_t position, const std::size_t size) {
+  int result = 0;
+  std::size_t i = position;
+  const std::size_t end = position + size;
+  while (i != end) {
+    const std::size_t length = end - i < 64 - (i & 63) ? end - i : 64 - (i & 63);
+    result += packed_popcount((x[i >> 6] >> (i & 63)) & packed_low_mask(length));
+    i += length;
+  }
+  return result;
+}
+
+/// \fn int packed_leading_ones(const uint64_t *x, const std::size_t n)
+/// \brief The number of consecutive ones of x from variable 0 on, by counting the trailing ones of its words.
+static inline int packed_leading_ones(const uint64_t *x, const std::size_t n) {
+  const std::size_t words = packed_words(n);
+  for (std::size_t w = 0; w != words; ++w) {
+    if (~x[w] != 0) {
+      const std::size_t result = w * 64 + packed_count_trailing_zeros(~x[w]);
+      return (int)(result < n ? result : n);
+    }
+  }
+  return (int)n;
+}
+
+/// \fn void packed_unpack(const uint64_t *x, const std::size_t n, InputType *y)
+/// \brief Writing the n variables of x into y.
+template <class InputType> static inline void packed_unpack(const uint64_t *x, const std::size_t n, InputType *y) {
+  for (std::size_t i = 0; i != n; ++i) {
+    y[i] = (InputType)packed_get(x,i);
+  }
+}
+
+#endif // _IOHPROFILER_PACKED_BITS_H
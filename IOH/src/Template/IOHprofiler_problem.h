@@ -9,6 +9,7 @@
 
 #include "IOHprofiler_common.h"
 #include "IOHprofiler_transformation.h"
+#include "IOHprofiler_evaluation_state.h"
 
 /// < transformation methods. 
 static IOHprofiler_transformation transformation;
@@ -34,13 +35,15 @@ public:
     lowerbound(std::vector<InputType> (number_of_variables) ), 
     upperbound(std::vector<InputType> (number_of_variables) ),
     optimal( /* std::vector<double>(number_of_objectives) <- do not initialise, so as to check for the exetrn initialization using size */),
-    optimalFound(false),
-    raw_objectives(std::vector<double>(number_of_objectives)),
-    transformed_objectives(std::vector<double>(number_of_objectives)),
-    evaluations(0),
-    best_so_far_raw_objectives(std::vector<double>(number_of_objectives) ),
-    best_so_far_raw_evaluations(0),
-    best_so_far_transformed_objectives(std::vector<double>(number_of_objectives) ) {}
+    evaluation_state(number_of_objectives),
+    integer_objective_range_flag(false),
+    integer_objective_lowerbound(0),
+    integer_objective_upperbound(0),
+    instance_prepared(false),
+    flip_incremental(false),
+    flip_raw_objective(0),
+    flip_last_index(0),
+    flip_last_raw_objective(0) {}
   
   virtual ~IOHprofiler_problem() {}
 
@@ -104,14 +107,154 @@ public:
   //   return this->transformed_objectives;
   // }
 
-  /// \fn double evaluate(std::vector<InputType> x)
+  /// \fn double evaluate(const std::vector<InputType> &x)
   /// \brife A common function for evaluating fitness of problems.
   ///
   /// Raw evaluate process, tranformation operations, and logging process are excuted 
-  /// in this function.
+  /// in this function. x is not copied: the transformed variables are written into a
+  /// buffer owned by the problem, and x is evaluated directly if the instance does not
+  /// transform the variables. The instance is prepared first if a setter invalidated it.
   /// \param x A InputType vector of variables.
   /// \return A double vector of objectives.
-  double evaluate(std::vector<InputType> x);
+  double evaluate(const std::vector<InputType> &x);
+
+  /// \fn double evaluate_detached(const std::vector<InputType> &x, double &raw_objective)
+  /// \brief Computing objectives of x without recording the evaluation.
+  ///
+  /// Tranformation operations are applied as in evaluate, but neither the number of
+  /// evaluations nor the best-so-far information is updated. As long as internal_evaluate
+  /// does not modify the problem (which holds for the pseudo-Boolean problems), this function
+  /// can be called by several threads at the same time. The instance must be prepared by
+  /// reset_problem() or update_instance() before. The result is to be recorded with record_evaluation.
+  /// \param x A InputType vector of variables.
+  /// \param raw_objective The objective before transformation.
+  /// \return The transformed objective.
+  double evaluate_detached(const std::vector<InputType> &x, double &raw_objective);
+
+  /// \fn void evaluate_detached(const std::vector<std::vector<InputType> > &x, std::vector<double> &raw_objectives, std::vector<double> &transformed_objectives)
+  /// \brief Computing objectives of a batch of solutions without recording the evaluations.
+  ///
+  /// Works as evaluate_detached for each solution, but reuses one buffer for the
+  /// transformed variables of all of them.
+  /// \param x The solutions.
+  /// \param raw_objectives The objectives before transformation, resized to x.size().
+  /// \param transformed_objectives The transformed objectives, resized to x.size().
+  void evaluate_detached(const std::vector<std::vector<InputType> > &x, std::vector<double> &raw_objectives, std::vector<double> &transformed_objectives);
+
+  /// \fn virtual bool internal_packed_supported() const
+  /// \brief Whether the problem evaluates packed bit strings directly.
+  ///
+  /// Problems supporting it override internal_evaluate_packed, which works on the transformed
+  /// variables packed into words of 64 bits (see IOHprofiler_packed_bits.h), with the bits after
+  /// the last variable set to 0. It must not change the problem, as internal_evaluate.
+  virtual bool internal_packed_supported() const {
+    return false;
+  }
+
+  /// \fn virtual double internal_evaluate_packed(const uint64_t *x, const std::size_t n)
+  /// \brief The raw objective of the n variables packed into x.
+  virtual double internal_evaluate_packed(const uint64_t *x, const std::size_t n) {
+    double result = std::numeric_limits<double>::lowest();
+    IOH_warning("No packed evaluate function defined");
+    return result;
+  }
+
+  /// \fn void evaluate_packed_detached(const uint64_t *x, const std::size_t count, std::vector<double> &raw_objectives, std::vector<double> &transformed_objectives)
+  /// \brief Computing objectives of a batch of solutions packed into words of 64 bits without recording the evaluations.
+  ///
+  /// x holds count solutions of packed_words(n) words each, where the bits after the last variable
+  /// of a solution are ignored. Pseudo-Boolean problems supporting it evaluate the packed solutions
+  /// with internal_evaluate_packed, other problems evaluate them unpacked as evaluate_detached does.
+  /// \param x The packed solutions.
+  /// \param count The number of solutions.
+  /// \param raw_objectives The objectives before transformation, resized to count.
+  /// \param transformed_objectives The transformed objectives, resized to count.
+  void evaluate_packed_detached(const uint64_t *x, const std::size_t count, std::vector<double> &raw_objectives, std::vector<double> &transformed_objectives);
+
+  /// \fn double record_evaluation(const double raw_objective, const double transformed_objective)
+  /// \brief Recording an evaluation computed by evaluate_detached.
+  ///
+  /// The problem is updated as if evaluate had been called with the evaluated solution.
+  /// \return The transformed objective.
+  double record_evaluation(const double raw_objective, const double transformed_objective);
+
+  /// \fn virtual bool internal_flip_supported() const
+  /// \brief Whether the problem evaluates single-bit flips incrementally.
+  ///
+  /// Problems supporting it override internal_evaluate_flip, and internal_prepare_flips and
+  /// internal_accept_flip if they keep additional information. All of them work on the
+  /// transformed variables.
+  virtual bool internal_flip_supported() const {
+    return false;
+  }
+
+  /// \fn virtual void internal_prepare_flips(const std::vector<InputType> &x)
+  /// \brief Preparing the incremental evaluation of single-bit flips of x.
+  virtual void internal_prepare_flips(const std::vector<InputType> &x) {
+  }
+
+  /// \fn virtual double internal_evaluate_flip(const std::vector<InputType> &x, const std::size_t i, const double raw_objective)
+  /// \brief The raw objective of x with the i-th variable flipped, given the raw objective of x.
+  virtual double internal_evaluate_flip(const std::vector<InputType> &x, const std::size_t i, const double raw_objective) {
+    double result = std::numeric_limits<double>::lowest();
+    IOH_warning("No flip evaluate function defined");
+    return result;
+  }
+
+  /// \fn virtual void internal_accept_flip(const std::vector<InputType> &x, const std::size_t i)
+  /// \brief Updating the prepared information before the i-th variable of x is flipped.
+  virtual void internal_accept_flip(const std::vector<InputType> &x, const std::size_t i) {
+  }
+
+  /// \fn void start_flips(const std::vector<InputType> &x)
+  /// \brief Setting x as the solution whose single-bit flips are evaluated by evaluate_flip.
+  ///
+  /// This is not counted as an evaluation.
+  /// \param x A InputType vector of variables.
+  void start_flips(const std::vector<InputType> &x);
+
+  /// \fn double evaluate_flip(const std::size_t i)
+  /// \brief Evaluating the solution set by start_flips with its i-th variable flipped.
+  ///
+  /// The evaluation is recorded as in evaluate. If the problem supports it, only the change
+  /// caused by the flip is computed, otherwise the flipped solution is evaluated completely.
+  /// The solution itself is kept.
+  /// \return The transformed objective.
+  double evaluate_flip(const std::size_t i);
+
+  /// \fn void accept_flip(const std::size_t i)
+  /// \brief Flipping the i-th variable of the solution set by start_flips.
+  void accept_flip(const std::size_t i);
+
+  /// \fn virtual void internal_transform_variables(std::vector<InputType> &x) const
+  ///
+  /// The transformation on variables of problems without transformation tables, such as
+  /// BBOB problems. It must not change the problem, so that it is thread-safe.
+  virtual void internal_transform_variables(std::vector<InputType> &x) const {
+    transformation.variables_transformation(x,this->problem_id,this->instance_id,this->problem_type);
+  }
+
+  /// \fn virtual void internal_transform_objectives(const std::vector<InputType> &x, std::vector<double> &y) const
+  ///
+  /// The transformation on objectives of problems without transformation tables, where x
+  /// is the solution before the transformation on variables.
+  virtual void internal_transform_objectives(const std::vector<InputType> &x, std::vector<double> &y) const {
+    transformation.objectives_transformation(x,y,this->problem_id,this->instance_id,this->problem_type);
+  }
+
+  /// \fn virtual bool instance_outdated() const
+  ///
+  /// Whether the data of the instance depend on parameters which were changed since
+  /// prepare_problem(), for problems whose parameters are public members.
+  virtual bool instance_outdated() const {
+    return false;
+  }
+
+  /// \fn virtual void problem_id_changed()
+  ///
+  /// Called by IOHprofiler_set_problem_id when the id changes. Problems whose instance
+  /// data or optimum depend on the id invalidate the instance here.
+  virtual void problem_id_changed() {}
 
   /// \fn virtual void customized_optimal()
   ///
@@ -136,8 +279,25 @@ public:
   /// \fn void reset_problem()
   ///
   /// \brief Reset problem as the default condition before doing evaluating.
+  ///
+  /// The counters and the best-so-far information of the run are reset. The data of the
+  /// instance (prepare_problem() and the optimum) are only computed again if a setter
+  /// invalidated them since they were computed.
   void reset_problem();
 
+  /// \fn void update_instance()
+  ///
+  /// Computes the data of the instance again if they were invalidated. Problems whose
+  /// instance is shared by several IOHprofiler_evaluator are to be updated before.
+  void update_instance();
+
+  /// \fn void invalidate_instance()
+  ///
+  /// Declares that the data of the instance have to be computed again by the next
+  /// reset_problem(). The setters of the problem call it, and problems whose
+  /// prepare_problem() depends on further parameters call it when these change.
+  void invalidate_instance();
+
   /// \fn std::vector<std::variant<int,double,std::string>> loggerInfo()
   ///
   /// Return a vector logger_info may be used by loggers.
@@ -165,14 +325,19 @@ public:
 
   int IOHprofiler_get_problem_id() const;
 
+  /// \fn IOHprofiler_set_problem_id(int problem_id)
+  ///
+  /// Only problems overriding problem_id_changed(), such as the BBOB problems, are
+  /// prepared again when the id changes.
   void IOHprofiler_set_problem_id(int problem_id);
   
   int IOHprofiler_get_instance_id() const;
   
   /// \fn IOHprofiler_set_instance_id(int instance_id)
   ///
-  /// To set instance_id of the problem. Since the optimal will be updated
-  /// as instanced_id updated, calc_optimal() is revoked here.
+  /// To set instance_id of the problem. The data of the instance and the optimal are
+  /// computed again by the next reset_problem() or evaluation, so that setting the
+  /// instance and then the dimension prepares the problem only once.
   /// \param instance_id 
   void IOHprofiler_set_instance_id(int instance_id);
 
@@ -202,6 +367,8 @@ public:
   /// 
   /// To set number_of_variables of the problem. When the number_of_variables is updated,
   /// best_variables, lowerbound, upperbound, and optimal need to be updated as well.
+  /// The instance data and the optimum are computed again by the next reset_problem()
+  /// or evaluation.
   ///
   /// \param number_of_variables
   void IOHprofiler_set_number_of_variables(const int number_of_variables);
@@ -211,6 +378,8 @@ public:
   /// To set number_of_variables of the problem. When the number_of_variables is updated,
   /// best_variables, lowerbound, upperbound, and optimal need to be updated as well. In case 
   /// the best value for each bit is not staic, another input 'best_variables' is supplied.
+  /// The instance data and the optimum are computed again by the next reset_problem()
+  /// or evaluation.
   ///
   /// \param number_of_variables, best_variables
   void IOHprofiler_set_number_of_variables(const int number_of_variables, const std::vector<InputType> &best_variables);
@@ -221,6 +390,11 @@ public:
 
   std::vector<double> IOHprofiler_get_raw_objectives() const;
 
+  /// \fn double IOHprofiler_get_last_raw_objective() const
+  ///
+  /// Return the (first) raw objective of the last evaluation without copying.
+  double IOHprofiler_get_last_raw_objective() const;
+
   std::vector<double> IOHprofiler_get_transformed_objectives() const;
 
   int IOHprofiler_get_transformed_number_of_variables() const;
@@ -261,7 +435,53 @@ public:
 
   void IOHprofiler_set_as_minimization();
 
+  /// \fn void IOHprofiler_set_integer_objective_range(const long long lowerbound, const long long upperbound)
+  ///
+  /// To declare that all raw objectives (before transformation) are integers within
+  /// [lowerbound, upperbound]. Problems call it in 'prepare_problem()', since the range
+  /// usually depends on the dimension. Algorithms may use it to index tables by objective values.
+  void IOHprofiler_set_integer_objective_range(const long long lowerbound, const long long upperbound);
+
+  bool IOHprofiler_has_integer_objective_range() const;
+
+  long long IOHprofiler_get_integer_objective_lowerbound() const;
+
+  long long IOHprofiler_get_integer_objective_upperbound() const;
+
 private:
+  /// \fn void prepare_instance()
+  ///
+  /// Computes the data of the instance by prepare_problem() and calc_optimal().
+  void prepare_instance();
+
+  /// \fn void require_prepared_instance() const
+  ///
+  /// Raises an error if the instance is not prepared. The detached evaluations do not
+  /// prepare it themselves, as they may be called by several threads at the same time.
+  void require_prepared_instance() const;
+
+  /// \fn void prepare_transformation()
+  ///
+  /// Computes the transformation tables of the current instance, dimension and problem type.
+  /// It is invoked by the setters of these.
+  void prepare_transformation();
+
+  /// \fn bool transforms_variables() const
+  ///
+  /// Whether the transformation on variables of the instance may change x, otherwise
+  /// x can be evaluated as it is.
+  bool transforms_variables() const;
+
+  /// \fn void transform_variables(const std::vector<InputType> &x, std::vector<InputType> &y) const
+  ///
+  /// Writes x after the transformation on variables of the instance into y.
+  void transform_variables(const std::vector<InputType> &x, std::vector<InputType> &y) const;
+
+  /// \fn void transform_objectives(const std::vector<InputType> &x, std::vector<double> &y) const
+  ///
+  /// Applies the transformation on objectives of the instance to the objectives y of x.
+  void transform_objectives(const std::vector<InputType> &x, std::vector<double> &y) const;
+
   int problem_id; /// < problem id, assigned as being added into a suite.
   int instance_id; /// < evaluate function is validated with instance and dimension. set default to avoid invalid class.
   
@@ -279,21 +499,29 @@ private:
   std::vector<InputType> best_variables; /// todo. comments, rename?
   std::vector<InputType> best_transformed_variables;
   std::vector<double> optimal; /// todo. How to evluate distance to optima. In global optima case, which optimum to be recorded.
-  bool optimalFound;
 
-  std::vector<double> raw_objectives; /// < to record objectives before transformation.
-  std::vector<double> transformed_objectives; /// < to record objectives after transformation.
   int transformed_number_of_variables; /// < intermediate variables in evaluate.
   std::vector<InputType> transformed_variables; /// < intermediate variables in evaluate.
+  IOHprofiler_transformation_tables<InputType> transformation_tables; /// < the transformations of the instance.
 
   /// todo. constrainted optimization.
   /// std::size_t number_of_constraints;
 
-  std::size_t evaluations; /// < to record optimization process. 
-  std::vector<double> best_so_far_raw_objectives; /// < to record optimization process.
-  int best_so_far_raw_evaluations; /// < to record optimization process.
-  std::vector<double> best_so_far_transformed_objectives; /// < to record optimization process.
-  int best_so_far_transformed_evaluations; /// < to record optimization process.
+  IOHprofiler_evaluation_state evaluation_state; /// < to record optimization process.
+
+  bool integer_objective_range_flag; /// < whether the raw objectives are known to be integers.
+  long long integer_objective_lowerbound; /// < the smallest possible integer raw objective.
+  long long integer_objective_upperbound; /// < the largest possible integer raw objective.
+
+  bool instance_prepared; /// < whether prepare_problem() and calc_optimal() are up to date.
+
+  bool flip_incremental; /// < whether evaluate_flip uses internal_evaluate_flip.
+  std::vector<InputType> flip_variables; /// < the solution set by start_flips.
+  std::vector<InputType> flip_transformed_variables; /// < flip_variables after transformation.
+  std::vector<int> flip_positions; /// < positions of the variables after transformation.
+  double flip_raw_objective; /// < the raw objective of flip_variables.
+  std::size_t flip_last_index; /// < the position flipped in the last evaluate_flip.
+  double flip_last_raw_objective; /// < the raw objective of the last evaluate_flip.
 };
 
 #include "IOHprofiler_problem.hpp"
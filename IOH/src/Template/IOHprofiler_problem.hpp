@@ -1,41 +1,191 @@
 
-template <class InputType> double IOHprofiler_problem<InputType>::evaluate(std::vector<InputType> x) {
-  assert(this->raw_objectives.size() >= 1);
-  assert(this->transformed_objectives.size() == this->raw_objectives.size());
+template <class InputType> double IOHprofiler_problem<InputType>::evaluate(const std::vector<InputType> &x) {
+  IOHprofiler_evaluation_state &state = this->evaluation_state;
+  assert(state.raw_objectives.size() >= 1);
+  assert(state.transformed_objectives.size() == state.raw_objectives.size());
 
-  ++this->evaluations;
+  if(x.size() != this->number_of_variables) {
+    ++state.evaluations;
+    IOH_warning("The dimension of solution is incorrect.");
+    if (this->maximization_minimization_flag == IOH_optimization_type::Maximization) {
+      state.raw_objectives[0] = std::numeric_limits<double>::lowest();
+      state.transformed_objectives[0] = std::numeric_limits<double>::lowest();
+    } else {
+      state.raw_objectives[0] = std::numeric_limits<double>::max();
+      state.transformed_objectives[0] = std::numeric_limits<double>::max();
+    }
+    return state.transformed_objectives[0];
+  }
+
+  if (!this->instance_prepared) {
+    this->prepare_instance();
+  }
+
+  const std::vector<InputType> *variables = &x;
+  if (this->transforms_variables()) {
+    this->transform_variables(x,this->transformed_variables);
+    variables = &this->transformed_variables;
+  }
+
+  state.raw_objectives[0] = this->internal_evaluate(*variables);
+
+  state.transformed_objectives[0] = state.raw_objectives[0];
 
+  this->transform_objectives(x,state.transformed_objectives);
+  return this->record_evaluation(state.raw_objectives[0],state.transformed_objectives[0]);
+}
+
+template <class InputType> double IOHprofiler_problem<InputType>::evaluate_detached(const std::vector<InputType> &x, double &raw_objective) {
   if(x.size() != this->number_of_variables) {
     IOH_warning("The dimension of solution is incorrect.");
     if (this->maximization_minimization_flag == IOH_optimization_type::Maximization) {
-      this->raw_objectives[0] = std::numeric_limits<double>::lowest();
-      this->transformed_objectives[0] = std::numeric_limits<double>::lowest();
+      raw_objective = std::numeric_limits<double>::lowest();
     } else {
-      this->raw_objectives[0] = std::numeric_limits<double>::max();
-      this->transformed_objectives[0] = std::numeric_limits<double>::max();
+      raw_objective = std::numeric_limits<double>::max();
     }
-    return this->transformed_objectives[0];
+    return raw_objective;
+  }
+
+  this->require_prepared_instance();
+
+  static thread_local std::vector<InputType> buffer;
+  const std::vector<InputType> *variables = &x;
+  if (this->transforms_variables()) {
+    this->transform_variables(x,buffer);
+    variables = &buffer;
   }
 
-  transformation.variables_transformation(x,this->problem_id,this->instance_id,this->problem_type);
+  raw_objective = this->internal_evaluate(*variables);
+
+  std::vector<double> transformed_objectives(1,raw_objective);
+  this->transform_objectives(x,transformed_objectives);
+  return transformed_objectives[0];
+}
 
-  this->raw_objectives[0] = this->internal_evaluate(x);
+template <class InputType> void IOHprofiler_problem<InputType>::evaluate_detached(const std::vector<std::vector<InputType> > &x, std::vector<double> &raw_objectives, std::vector<double> &transformed_objectives) {
+  raw_objectives.resize(x.size());
+  transformed_objectives.resize(x.size());
+  this->require_prepared_instance();
 
-  this->transformed_objectives[0] = this->raw_objectives[0];
+  const bool transform = this->transforms_variables();
+  std::vector<InputType> buffer;
+  std::vector<double> objectives(1);
+  for (std::size_t i = 0; i != x.size(); ++i) {
+    if(x[i].size() != this->number_of_variables) {
+      IOH_warning("The dimension of solution is incorrect.");
+      if (this->maximization_minimization_flag == IOH_optimization_type::Maximization) {
+        raw_objectives[i] = std::numeric_limits<double>::lowest();
+      } else {
+        raw_objectives[i] = std::numeric_limits<double>::max();
+      }
+      transformed_objectives[i] = raw_objectives[i];
+      continue;
+    }
 
-  transformation.objectives_transformation(x,this->transformed_objectives,this->problem_id,this->instance_id,this->problem_type);
-  if (compareObjectives(this->transformed_objectives,this->best_so_far_transformed_objectives,this->maximization_minimization_flag)) {
-    this->best_so_far_transformed_objectives = this->transformed_objectives;
-    this->best_so_far_transformed_evaluations = this->evaluations;
-    this->best_so_far_raw_objectives = this->raw_objectives;
-    this->best_so_far_raw_evaluations = this->evaluations;
+    const std::vector<InputType> *variables = &x[i];
+    if (transform) {
+      this->transform_variables(x[i],buffer);
+      variables = &buffer;
+    }
+
+    raw_objectives[i] = this->internal_evaluate(*variables);
+
+    objectives[0] = raw_objectives[i];
+    this->transform_objectives(x[i],objectives);
+    transformed_objectives[i] = objectives[0];
   }
+}
 
-  if (compareVector(this->transformed_objectives,this->optimal)) {
-    this->optimalFound = true;
+template <class InputType> void IOHprofiler_problem<InputType>::evaluate_packed_detached(const uint64_t *x, const std::size_t count, std::vector<double> &raw_objectives, std::vector<double> &transformed_objectives) {
+  raw_objectives.resize(count);
+  transformed_objectives.resize(count);
+  this->require_prepared_instance();
+
+  const std::size_t n = this->number_of_variables;
+  const std::size_t words = packed_words(n);
+  const bool packed = this->transformation_tables.handles_problem() && this->internal_packed_supported();
+  const bool transform = this->transforms_variables();
+  std::vector<uint64_t> transformed(packed ? words : 0);
+  std::vector<InputType> unpacked(packed ? 0 : n);
+  std::vector<InputType> buffer;
+  std::vector<double> objectives(1);
+  for (std::size_t k = 0; k != count; ++k) {
+    const uint64_t *solution = x + k * words;
+    if (packed) {
+      this->transformation_tables.variables_transformation_packed(solution,n,transformed.data());
+      raw_objectives[k] = this->internal_evaluate_packed(transformed.data(),n);
+      objectives[0] = raw_objectives[k];
+      this->transformation_tables.objectives_transformation(objectives);
+    } else {
+      packed_unpack(solution,n,unpacked.data());
+      const std::vector<InputType> *variables = &unpacked;
+      if (transform) {
+        this->transform_variables(unpacked,buffer);
+        variables = &buffer;
+      }
+      raw_objectives[k] = this->internal_evaluate(*variables);
+      objectives[0] = raw_objectives[k];
+      this->transform_objectives(unpacked,objectives);
+    }
+    transformed_objectives[k] = objectives[0];
   }
+}
+
+template <class InputType> double IOHprofiler_problem<InputType>::record_evaluation(const double raw_objective, const double transformed_objective) {
+  return this->evaluation_state.record(raw_objective,transformed_objective,this->optimal,this->maximization_minimization_flag);
+}
 
-  return this->transformed_objectives[0];
+template <class InputType> void IOHprofiler_problem<InputType>::start_flips(const std::vector<InputType> &x) {
+  if (!this->instance_prepared) {
+    this->prepare_instance();
+  }
+  this->flip_variables = x;
+  this->flip_incremental = this->internal_flip_supported() && x.size() == this->number_of_variables;
+  if (this->flip_incremental) {
+    this->transform_variables(x,this->flip_transformed_variables);
+    if (this->transformation_tables.handles_problem()) {
+      this->flip_positions = this->transformation_tables.variables_positions();
+    } else {
+      this->flip_positions = transformation.variables_positions(this->number_of_variables,this->problem_id,this->instance_id,this->problem_type);
+    }
+    this->internal_prepare_flips(this->flip_transformed_variables);
+    this->flip_raw_objective = this->internal_evaluate(this->flip_transformed_variables);
+    this->flip_last_index = this->number_of_variables;
+  }
+}
+
+template <class InputType> double IOHprofiler_problem<InputType>::evaluate_flip(const std::size_t i) {
+  if (!this->flip_incremental) {
+    this->flip_variables[i] = 1 - this->flip_variables[i];
+    const double result = this->evaluate(this->flip_variables);
+    this->flip_variables[i] = 1 - this->flip_variables[i];
+    return result;
+  }
+
+  this->flip_last_index = this->flip_positions[i];
+  this->flip_last_raw_objective = this->internal_evaluate_flip(this->flip_transformed_variables,this->flip_last_index,this->flip_raw_objective);
+
+  std::vector<double> &transformed_objectives = this->evaluation_state.transformed_objectives;
+  transformed_objectives[0] = this->flip_last_raw_objective;
+  this->transform_objectives(this->flip_transformed_variables,transformed_objectives);
+  return this->record_evaluation(this->flip_last_raw_objective,transformed_objectives[0]);
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::accept_flip(const std::size_t i) {
+  this->flip_variables[i] = 1 - this->flip_variables[i];
+  if (!this->flip_incremental) {
+    return;
+  }
+
+  const std::size_t position = this->flip_positions[i];
+  if (position != this->flip_last_index) {
+    this->flip_last_index = position;
+    this->flip_last_raw_objective = this->internal_evaluate_flip(this->flip_transformed_variables,position,this->flip_raw_objective);
+  }
+  this->internal_accept_flip(this->flip_transformed_variables,position);
+  this->flip_transformed_variables[position] = 1 - this->flip_transformed_variables[position];
+  this->flip_raw_objective = this->flip_last_raw_objective;
+  this->flip_last_index = this->number_of_variables;
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::calc_optimal() {
@@ -43,18 +193,11 @@ template <class InputType> void IOHprofiler_problem<InputType>::calc_optimal() {
     /// todo. Make Exception.
     /// Do not apply transformation on best_variables as calculating optimal
     if (this->number_of_objectives == 1) {
-      /// This only works for F4, F16-18, and F23 of BBOB suite.
-      if(this->problem_type == "bbob") {
-        Coco_Transformation_Data::raw_x.clear();
-        for (std::size_t i = 0; i != this->best_variables.size(); ++i) {
-          Coco_Transformation_Data::raw_x.push_back(this->best_variables[i]);
-        }
-      }
       this->optimal[0] = internal_evaluate(this->best_variables);
     } else {
       IOH_warning("Multi-objectives optimization is not supported now.");
     }
-    transformation.objectives_transformation(this->best_variables,this->optimal,this->problem_id,this->instance_id,this->problem_type);
+    this->transform_objectives(this->best_variables,this->optimal);
   }
   else {
     this->optimal.clear();
@@ -66,51 +209,80 @@ template <class InputType> void IOHprofiler_problem<InputType>::calc_optimal() {
       }
     }
     customize_optimal();
-    transformation.objectives_transformation(this->best_variables,this->optimal,this->problem_id,this->instance_id,this->problem_type);
+    this->transform_objectives(this->best_variables,this->optimal);
   }
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::reset_problem() {
-  this->evaluations = 0;
-  this->best_so_far_raw_evaluations = 0;
-  this->best_so_far_transformed_evaluations = 0;
-  this->optimalFound = false;
-  for (size_t i = 0; i != this->number_of_objectives; ++i) {
-    if (this->maximization_minimization_flag == IOH_optimization_type::Maximization) {
-      this->best_so_far_raw_objectives[i] = std::numeric_limits<double>::lowest();
-      this->best_so_far_transformed_objectives[i] = std::numeric_limits<double>::lowest();
-    } else {
-      this->best_so_far_raw_objectives[i] = std::numeric_limits<double>::max();
-      this->best_so_far_transformed_objectives[i] = std::numeric_limits<double>::max();
-    }
+  this->evaluation_state.reset(this->number_of_objectives,this->maximization_minimization_flag);
+  this->update_instance();
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::update_instance() {
+  if (!this->instance_prepared || this->instance_outdated()) {
+    this->prepare_instance();
   }
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::invalidate_instance() {
+  this->instance_prepared = false;
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::prepare_instance() {
   this->prepare_problem();
   this->calc_optimal();
+  this->instance_prepared = true;
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::require_prepared_instance() const {
+  if (!this->instance_prepared) {
+    IOH_error("The instance is not prepared, reset_problem() or update_instance() is to be called before evaluating detached.");
+  }
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::prepare_transformation() {
+  this->transformation_tables.prepare(this->number_of_variables,this->instance_id,this->problem_type);
+}
+
+template <class InputType> bool IOHprofiler_problem<InputType>::transforms_variables() const {
+  return !this->transformation_tables.handles_problem() || this->transformation_tables.transforms_variables();
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::transform_variables(const std::vector<InputType> &x, std::vector<InputType> &y) const {
+  if (this->transformation_tables.handles_problem() && x.size() == this->number_of_variables) {
+    this->transformation_tables.variables_transformation(x,y);
+  } else {
+    y.assign(x.begin(),x.end());
+    this->internal_transform_variables(y);
+  }
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::transform_objectives(const std::vector<InputType> &x, std::vector<double> &y) const {
+  if (this->transformation_tables.handles_problem()) {
+    this->transformation_tables.objectives_transformation(y);
+  } else {
+    this->internal_transform_objectives(x,y);
+  }
 }
 
 template <class InputType> std::vector<double> IOHprofiler_problem<InputType>::loggerCOCOInfo() const{
+  const IOHprofiler_evaluation_state &state = this->evaluation_state;
   std::vector<double> logger_info(5);
-  logger_info[0] = (double)this->evaluations;
-  logger_info[1] = this->transformed_objectives[0] - this->optimal[0];
-  logger_info[2] = this->best_so_far_transformed_objectives[0] - this->optimal[0];
-  logger_info[3] = this->transformed_objectives[0];
-  logger_info[4] = this->best_so_far_transformed_objectives[0];
+  logger_info[0] = (double)state.evaluations;
+  logger_info[1] = state.transformed_objectives[0] - this->optimal[0];
+  logger_info[2] = state.best_so_far_transformed_objectives[0] - this->optimal[0];
+  logger_info[3] = state.transformed_objectives[0];
+  logger_info[4] = state.best_so_far_transformed_objectives[0];
 
   return logger_info;
 }
 
 template <class InputType> std::vector<double> IOHprofiler_problem<InputType>::loggerInfo() const{
-  std::vector<double> logger_info(5);
-  logger_info[0] = (double)this->evaluations;
-  logger_info[1] = this->raw_objectives[0];
-  logger_info[2] = this->best_so_far_raw_objectives[0];
-  logger_info[3] = this->transformed_objectives[0];
-  logger_info[4] = this->best_so_far_transformed_objectives[0];
-  return logger_info;
+  return this->evaluation_state.loggerInfo();
 }
 
 template <class InputType> bool IOHprofiler_problem<InputType>::IOHprofiler_hit_optimal() const {
-  return this->optimalFound;
+  return this->evaluation_state.optimalFound;
 }
 
 template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_problem_id() const {
@@ -118,7 +290,10 @@ template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_p
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_problem_id(int problem_id){
-  this->problem_id = problem_id;
+  if (problem_id != this->problem_id) {
+    this->problem_id = problem_id;
+    this->problem_id_changed();
+  }
 }
 
 template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_instance_id() const {
@@ -127,8 +302,8 @@ template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_i
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_instance_id(int instance_id) {
   this->instance_id = instance_id;
-  this->prepare_problem();
-  this->calc_optimal();
+  this->prepare_transformation();
+  this->invalidate_instance();
 }
 
 template <class InputType> std::string IOHprofiler_problem<InputType>::IOHprofiler_get_problem_name() const {
@@ -145,6 +320,8 @@ template <class InputType> std::string IOHprofiler_problem<InputType>::IOHprofil
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_problem_type(std::string problem_type) {
   this->problem_type = problem_type;
+  this->prepare_transformation();
+  this->invalidate_instance();
 }
 
 template <class InputType> std::vector<InputType> IOHprofiler_problem<InputType>::IOHprofiler_get_lowerbound() const {
@@ -194,8 +371,8 @@ template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_
   if (this->upperbound.size() != 0) {
     this->IOHprofiler_set_upperbound(this->upperbound[0]);
   }
-  this->prepare_problem();
-  this->calc_optimal();
+  this->prepare_transformation();
+  this->invalidate_instance();
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_number_of_variables(const int number_of_variables, const std::vector<InputType> &best_variables) {
@@ -207,8 +384,8 @@ template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_
   if (this->upperbound.size() != 0) {
     this->IOHprofiler_set_upperbound(this->upperbound[0]);
   }
-  this->prepare_problem();
-  this->calc_optimal();
+  this->prepare_transformation();
+  this->invalidate_instance();
 }
 
 template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_number_of_objectives() const {
@@ -217,24 +394,23 @@ template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_n
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_number_of_objectives(const int number_of_objectives) {
   this->number_of_objectives = number_of_objectives;
-  this->raw_objectives = std::vector<double>(this->number_of_objectives);
-  this->transformed_objectives = std::vector<double>(this->number_of_objectives);
-  if (this->maximization_minimization_flag == IOH_optimization_type::Maximization) {
-    this->best_so_far_raw_objectives = std::vector<double>(this->number_of_objectives,std::numeric_limits<double>::lowest());
-    this->best_so_far_transformed_objectives = std::vector<double>(this->number_of_objectives,std::numeric_limits<double>::lowest());
-  } else {
-    this->best_so_far_raw_objectives = std::vector<double>(this->number_of_objectives,std::numeric_limits<double>::max());
-    this->best_so_far_transformed_objectives = std::vector<double>(this->number_of_objectives,std::numeric_limits<double>::max());
-  }
+  this->evaluation_state.raw_objectives = std::vector<double>(this->number_of_objectives);
+  this->evaluation_state.transformed_objectives = std::vector<double>(this->number_of_objectives);
+  this->evaluation_state.reset_best_so_far(this->number_of_objectives,this->maximization_minimization_flag);
   this->optimal = std::vector<double>(this->number_of_objectives);
+  this->invalidate_instance();
 }
 
 template <class InputType> std::vector<double> IOHprofiler_problem<InputType>::IOHprofiler_get_raw_objectives() const {
-  return this->raw_objectives;
+  return this->evaluation_state.raw_objectives;
+}
+
+template <class InputType> double IOHprofiler_problem<InputType>::IOHprofiler_get_last_raw_objective() const {
+  return this->evaluation_state.raw_objectives[0];
 }
 
 template <class InputType> std::vector<double> IOHprofiler_problem<InputType>::IOHprofiler_get_transformed_objectives() const {
-  return this->transformed_objectives;
+  return this->evaluation_state.transformed_objectives;
 }
 
 template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_transformed_number_of_variables() const {
@@ -254,10 +430,12 @@ template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_
   for (std::size_t i = 0; i < this->number_of_variables; ++i) {
     this->best_variables.push_back(best_variables);
   }
+  this->invalidate_instance();
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_best_variables(const std::vector<InputType> &best_variables) {
   this->best_variables = best_variables;
+  this->invalidate_instance();
 }
 
 template <class InputType> bool IOHprofiler_problem<InputType>::IOHprofiler_has_optimal() const {
@@ -277,38 +455,42 @@ template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_
   for (std::size_t i = 0; i < this->number_of_objectives; ++i) {
     this->optimal.push_back(optimal);
   }
+  this->invalidate_instance();
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_optimal(const std::vector<double> &optimal) {
   this->optimal = optimal;
+  this->invalidate_instance();
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_evaluate_optimal(std::vector<InputType> best_variables) {
   this->optimal[0] = this->evaluate(best_variables);
+  this->invalidate_instance();
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_evaluate_optimal() {
   this->optimal[0] = this->evaluate(this->best_variables);
+  this->invalidate_instance();
 }
 
 template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_evaluations() const {
-  return this->evaluations;
+  return this->evaluation_state.evaluations;
 }
 
 template <class InputType> std::vector<double> IOHprofiler_problem<InputType>::IOHprofiler_get_best_so_far_raw_objectives() const {
-  return this->best_so_far_raw_objectives;
+  return this->evaluation_state.best_so_far_raw_objectives;
 }
 
 template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_best_so_far_raw_evaluations() const {
-  return this-> best_so_far_raw_evaluations;
+  return this->evaluation_state.best_so_far_raw_evaluations;
 }
 
 template <class InputType> std::vector<double> IOHprofiler_problem<InputType>::IOHprofiler_get_best_so_far_transformed_objectives() const {
-  return this->best_so_far_transformed_objectives;
+  return this->evaluation_state.best_so_far_transformed_objectives;
 }
 
 template <class InputType> int IOHprofiler_problem<InputType>::IOHprofiler_get_best_so_far_transformed_evaluations() const {
-  return this->best_so_far_transformed_evaluations;
+  return this->evaluation_state.best_so_far_transformed_evaluations;
 }
 
 template <class InputType> IOH_optimization_type IOHprofiler_problem<InputType>::IOHprofiler_get_optimization_type() const {
@@ -317,16 +499,33 @@ template <class InputType> IOH_optimization_type IOHprofiler_problem<InputType>:
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_as_maximization() {
   this->maximization_minimization_flag = IOH_optimization_type::Maximization;
-  for (std::size_t i = 0; i !=  this->number_of_objectives; ++i) {
-    this->best_so_far_raw_objectives[i] = std::numeric_limits<double>::lowest();
-    this->best_so_far_transformed_objectives[i] = std::numeric_limits<double>::lowest();
-  }
+  this->evaluation_state.reset_best_so_far(this->number_of_objectives,this->maximization_minimization_flag);
+  this->invalidate_instance();
 }
 
 template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_as_minimization() {
   this->maximization_minimization_flag = IOH_optimization_type::Minimization;
-  for (std::size_t i = 0; i !=  this->number_of_objectives; ++i) {
-    this->best_so_far_raw_objectives[i] = std::numeric_limits<double>::max();
-    this->best_so_far_transformed_objectives[i] = std::numeric_limits<double>::max();
+  this->evaluation_state.reset_best_so_far(this->number_of_objectives,this->maximization_minimization_flag);
+  this->invalidate_instance();
+}
+
+template <class InputType> void IOHprofiler_problem<InputType>::IOHprofiler_set_integer_objective_range(const long long lowerbound, const long long upperbound) {
+  if (lowerbound > upperbound) {
+    IOH_error("The lowerbound of the integer objective range is larger than its upperbound");
   }
+  this->integer_objective_range_flag = true;
+  this->integer_objective_lowerbound = lowerbound;
+  this->integer_objective_upperbound = upperbound;
+}
+
+template <class InputType> bool IOHprofiler_problem<InputType>::IOHprofiler_has_integer_objective_range() const {
+  return this->integer_objective_range_flag;
+}
+
+template <class InputType> long long IOHprofiler_problem<InputType>::IOHprofiler_get_integer_objective_lowerbound() const {
+  return this->integer_objective_lowerbound;
+}
+
+template <class InputType> long long IOHprofiler_problem<InputType>::IOHprofiler_get_integer_objective_upperbound() const {
+  return this->integer_objective_upperbound;
 }
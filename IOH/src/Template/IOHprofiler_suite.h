@@ -27,6 +27,7 @@ public:
     size_of_problem_list(0),
     get_problem_flag(false),
     load_problem_flag(false),
+    lazy_load_flag(false),
     current_problem(nullptr) {
     }
   ~IOHprofiler_suite() {}
@@ -47,9 +48,16 @@ public:
   /// \brief Allocating memeory and creating instances of problems to be included in the suite.
   ///
   /// Before acquiring a problem from the suite, this function must be invoked.
-  /// Otherwise the list of problem is empty.
+  /// Otherwise the list of problem is empty. In the lazy mode, no problem is created here,
+  /// see IOHprofiler_set_lazy_load_flag.
   virtual void loadProblem();
 
+  /// \fn Problem_ptr create_problem(const size_t index)
+  /// \brief Creating the problem at the given index of the list of problems.
+  ///
+  /// The problems are ordered by problem, then by dimension, then by instance.
+  virtual Problem_ptr create_problem(const size_t index);
+
   /// \fn std::shared_ptr<IOHprofiler_problem<InputType>> get_next_problem()
   /// \brief An interface of requesting problems in suite.
   ///
@@ -117,6 +125,16 @@ public:
   
   void IOHprofiler_set_get_problem_flag(const bool flag);
 
+  bool IOHprofiler_get_lazy_load_flag() const;
+
+  /// \fn void IOHprofiler_set_lazy_load_flag(const bool flag)
+  ///
+  /// In the lazy mode, loadProblem() does not create the problems of the suite. Instead,
+  /// get_next_problem() creates each problem when it is reached and releases the previous
+  /// one, so only the problems in use are kept in memory. The mode applies from the next
+  /// loadProblem() on, so suites take it as a constructor argument.
+  void IOHprofiler_set_lazy_load_flag(const bool flag);
+
   void IOHprofiler_set_size_of_problem_list(const size_t size_of_problem_list);
 
   void IOHprofiler_set_problem_list_index(const size_t problem_list_index);
@@ -124,6 +142,12 @@ public:
   void mapIDTOName(const int id, const std::string name);
 
 private:
+  /// \fn Problem_ptr generate_problem(const std::string &problem_name, const int problem_id, const int instance, const int dimension)
+  /// \brief Creating a registered problem for the instance and the dimension, and assigning the problem_id.
+  ///
+  /// The instance of the problem is prepared, so that its optimum is available.
+  Problem_ptr generate_problem(const std::string &problem_name, const int problem_id, const int instance, const int dimension);
+
   std::string suite_name;
   int number_of_problems;
   int number_of_instances;
@@ -140,6 +164,7 @@ private:
   size_t size_of_problem_list;
   bool get_problem_flag;
   bool load_problem_flag;
+  bool lazy_load_flag; /// < whether the problems are created when they are requested.
 
   Problem_ptr current_problem;
 };
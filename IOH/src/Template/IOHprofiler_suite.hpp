@@ -4,22 +4,27 @@ template <class InputType> void IOHprofiler_suite<InputType>::loadProblem() {
   }
   this->size_of_problem_list = this->number_of_dimensions * this->number_of_instances * this->number_of_problems;
   this->problem_list_index = 0;
+  this->current_problem = nullptr;
 
-  for (int i = 0; i != this->number_of_problems; ++i) {
-    for (int j = 0; j != this->number_of_dimensions; ++j) {
-      for (int h = 0; h != this->number_of_instances; ++h) {
-        Problem_ptr p = get_problem(this->problem_id_name_map[this->problem_id[i]],
-                                      this->instance_id[h],
-                                      this->dimension[j]);
-        this->push_back(p);
-      }
+  if (!this->lazy_load_flag) {
+    for (size_t index = 0; index != this->size_of_problem_list; ++index) {
+      this->push_back(this->create_problem(index));
     }
+    assert(this->size_of_problem_list == this->size());
   }
-  assert(this->size_of_problem_list == this->size());
   this->get_problem_flag = false;
   this->load_problem_flag = true;
 }
 
+template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHprofiler_suite<InputType>::create_problem(const size_t index) {
+  const size_t h = index % this->number_of_instances;
+  const size_t j = index / this->number_of_instances % this->number_of_dimensions;
+  const size_t i = index / this->number_of_instances / this->number_of_dimensions;
+  return get_problem(this->problem_id_name_map[this->problem_id[i]],
+                     this->instance_id[h],
+                     this->dimension[j]);
+}
+
 template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHprofiler_suite<InputType>::get_next_problem() {
   if (this->load_problem_flag == false) {
     this->loadProblem();
@@ -31,6 +36,9 @@ template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHp
   }
 
   if (this->problem_list_index == this->size_of_problem_list - 1 && this->get_problem_flag == true) {
+    if (this->lazy_load_flag) {
+      this->current_problem = nullptr;
+    }
     return nullptr;
   }
 
@@ -38,8 +46,14 @@ template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHp
     this->get_problem_flag = true;
   } else {
     this->problem_list_index++;
-  }    
-  this->current_problem = (*this)[problem_list_index];
+  }
+  if (this->lazy_load_flag) {
+    /// the previous problem is released before the next one is created
+    this->current_problem = nullptr;
+    this->current_problem = this->create_problem(this->problem_list_index);
+  } else {
+    this->current_problem = (*this)[problem_list_index];
+  }
   
   this->current_problem->reset_problem();
   return this->current_problem;
@@ -53,28 +67,36 @@ template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHp
   if (this->get_problem_flag == false) {
     this->get_problem_flag = true;
   }
-  this->current_problem = (*this)[this->problem_list_index];
+  if (!this->lazy_load_flag) {
+    this->current_problem = (*this)[this->problem_list_index];
+  } else if (this->current_problem == nullptr) {
+    this->current_problem = this->create_problem(this->problem_list_index);
+  }
   this->current_problem->reset_problem();
   return this->current_problem;
 }
 
 template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHprofiler_suite<InputType>::get_problem(std::string problem_name, int instance, int dimension) {
-  Problem_ptr p = genericGenerator<IOHprofiler_problem<InputType> >::instance().create(problem_name);
-  assert(p != nullptr);
-  p->reset_problem();
-  p->IOHprofiler_set_problem_id(this->problem_name_id_map[problem_name]);
-  p->IOHprofiler_set_instance_id(instance);
-  p->IOHprofiler_set_number_of_variables(dimension);
-  return p;
+  return this->generate_problem(problem_name, this->problem_name_id_map[problem_name], instance, dimension);
 }
 
 template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHprofiler_suite<InputType>::get_problem(int problem_id, int instance, int dimension) {
-  Problem_ptr p = genericGenerator<IOHprofiler_problem<InputType> >::instance().create(this->problem_id_name_map[problem_id]);
-  assert(p != nullptr);
-  p->reset_problem();
+  return this->generate_problem(this->problem_id_name_map[problem_id], problem_id, instance, dimension);
+}
+
+template <class InputType> std::shared_ptr<IOHprofiler_problem<InputType> > IOHprofiler_suite<InputType>::generate_problem(const std::string &problem_name, const int problem_id, const int instance, const int dimension) {
+  const genericGenerator<IOHprofiler_problem<InputType> > &generator = genericGenerator<IOHprofiler_problem<InputType> >::instance();
+  /// the problem is created directly for the instance and dimension if it supports it
+  Problem_ptr p = generator.create(problem_name, instance, dimension);
+  if (p == nullptr) {
+    p = generator.create(problem_name);
+    assert(p != nullptr);
+    p->IOHprofiler_set_instance_id(instance);
+    p->IOHprofiler_set_number_of_variables(dimension);
+  }
   p->IOHprofiler_set_problem_id(problem_id);
-  p->IOHprofiler_set_instance_id(instance);
-  p->IOHprofiler_set_number_of_variables(dimension);
+  /// prepared once, for the final instance, dimension and id
+  p->update_instance();
   return p;
 }
 
@@ -163,6 +185,14 @@ template <class InputType> void IOHprofiler_suite<InputType>::IOHprofiler_set_ge
   this->get_problem_flag = flag;
 }
 
+template <class InputType> bool IOHprofiler_suite<InputType>::IOHprofiler_get_lazy_load_flag() const {
+  return this->lazy_load_flag;
+}
+
+template <class InputType> void IOHprofiler_suite<InputType>::IOHprofiler_set_lazy_load_flag(const bool flag) {
+  this->lazy_load_flag = flag;
+}
+
 template <class InputType> void IOHprofiler_suite<InputType>::IOHprofiler_set_size_of_problem_list(const size_t size_of_problem_list) {
   this->size_of_problem_list = size_of_problem_list;
 }
@@ -19,9 +19,6 @@ void IOHprofiler_transformation::variables_transformation(std::vector<int> &x, c
 }
 
 void IOHprofiler_transformation::variables_transformation(std::vector<double> &x, const int problem_id, const int instance_id, const std::string problem_type) {
-  if (problem_type == "bbob") {
-    coco_tranformation_vars(x,problem_id);
-  }
 }
 
 void IOHprofiler_transformation::objectives_transformation(const std::vector<int> &x, std::vector<double> &y, const int problem_id, const int instance_id, const std::string problem_type) {
@@ -34,23 +31,43 @@ void IOHprofiler_transformation::objectives_transformation(const std::vector<int
 }
 
 void IOHprofiler_transformation::objectives_transformation(const std::vector<double> &x, std::vector<double> &y, const int problem_id, const int instance_id, const std::string problem_type) {
-  if (problem_type == "bbob") {
-    coco_tranformation_objs(x,y,problem_id);
+}
+
+std::vector<int> IOHprofiler_transformation::variables_positions(const int number_of_variables, const int problem_id, const int instance_id, const std::string problem_type) {
+  std::vector<int> positions(number_of_variables);
+  std::vector<int> origins(number_of_variables);
+  for (int i = 0; i != number_of_variables; ++i) {
+    origins[i] = i;
+  }
+  /// sigma moves the variable origins[k] to position k, xor keeps all positions.
+  if (problem_type == "pseudo_Boolean_problem" && instance_id > 50 && instance_id <= 100) {
+    this->transform_vars_sigma(origins,instance_id);
   }
+  for (int k = 0; k != number_of_variables; ++k) {
+    positions[origins[k]] = k;
+  }
+  return positions;
 }
 
 int IOHprofiler_transformation::xor_compute(const int x1, const int x2){
   return (int) (x1 != x2);
 }
 
-void IOHprofiler_transformation::transform_vars_xor(std::vector<int> &x, const int seed) {
+std::vector<int> IOHprofiler_transformation::xor_mask(const int n, const int seed) {
   std::vector<double> random_x;
-  int xor_value;
-  int n = x.size();
+  std::vector<int> mask(n);
   IOHprofiler_random::IOHprofiler_uniform_rand(n,seed, random_x);
   for (int i = 0; i < n; ++i) {
-    xor_value = (int)(2 * floor(1e4 * random_x[i]) / 1e4);
-    x[i] = xor_compute(x[i],xor_value);
+    mask[i] = (int)(2 * floor(1e4 * random_x[i]) / 1e4);
+  }
+  return mask;
+}
+
+void IOHprofiler_transformation::transform_vars_xor(std::vector<int> &x, const int seed) {
+  const std::vector<int> mask = xor_mask(x.size(),seed);
+  int n = x.size();
+  for (int i = 0; i < n; ++i) {
+    x[i] = xor_compute(x[i],mask[i]);
   }
 }
 
@@ -58,13 +75,10 @@ int IOHprofiler_transformation::sigma_compute(const std::vector<int> &x, const i
   return x[pos];
 }
 
-void IOHprofiler_transformation::transform_vars_sigma(std::vector<int> &x, const int seed) {
-  std::vector<int> copy_x;
+std::vector<int> IOHprofiler_transformation::sigma_index(const int N, const int seed) {
   std::vector<int> index;
   std::vector<double> random_x;
-  int N = x.size(),t,temp;
-  
-  copy_x = x;
+  int t,temp;
 
   index.reserve(N);
   for (int i = 0; i != N; ++i) {
@@ -78,39 +92,48 @@ void IOHprofiler_transformation::transform_vars_sigma(std::vector<int> &x, const
     index[0] = index[t];
     index[t] = temp;
   }
+  return index;
+}
+
+void IOHprofiler_transformation::transform_vars_sigma(std::vector<int> &x, const int seed) {
+  const std::vector<int> copy_x = x;
+  const std::vector<int> index = sigma_index(x.size(),seed);
+  int N = x.size();
   for (int i = 0; i < N; ++i) {
     x[i] = sigma_compute(copy_x,index[i]);
   }
 }
 
-void IOHprofiler_transformation::transform_obj_scale(std::vector<double> &y, const int seed) {
+double IOHprofiler_transformation::obj_scale(const int seed) {
   std::vector<double> scale;
   IOHprofiler_random::IOHprofiler_uniform_rand(1,seed,scale);
-  scale[0] = scale[0] * 1e4 / 1e4 * 4.8 + 0.2;
+  return scale[0] * 1e4 / 1e4 * 4.8 + 0.2;
+}
+
+double IOHprofiler_transformation::obj_shift(const int seed) {
+  std::vector<double> shift;
+  IOHprofiler_random::IOHprofiler_uniform_rand(1,seed,shift);
+  return shift[0] * 1e4 / 1e4 * 2000 - 1000;
+}
+
+void IOHprofiler_transformation::transform_obj_scale(std::vector<double> &y, const int seed) {
+  const double scale = obj_scale(seed);
   for (size_t i = 0; i < y.size(); ++i) {
-    y[i] = y[i] * scale[0];
+    y[i] = y[i] * scale;
   }
 }
 
 void IOHprofiler_transformation::transform_obj_shift(std::vector<double> &y, const int seed) {
-  std::vector<double> shift;
-  IOHprofiler_random::IOHprofiler_uniform_rand(1,seed,shift);
-  shift[0] = shift[0] * 1e4 / 1e4 * 2000 - 1000;
+  const double shift = obj_shift(seed);
   for (size_t i = 0; i < y.size(); ++i) {
-    y[i] = y[i] + shift[0];
+    y[i] = y[i] + shift;
   }
 }
 
 void IOHprofiler_transformation::transform_obj_scale(double &y, const int seed) {
-  std::vector<double> scale;
-  IOHprofiler_random::IOHprofiler_uniform_rand(1,seed,scale);
-  scale[0] = scale[0] * 1e4 / 1e4 * 4.8 + 0.2;
-  y = y * scale[0];
+  y = y * obj_scale(seed);
 }
 
 void IOHprofiler_transformation::transform_obj_shift(double &y, const int seed) {
-  std::vector<double> shift;
-  IOHprofiler_random::IOHprofiler_uniform_rand(1,seed,shift);
-  shift[0] = shift[0] * 1e4 / 1e4 * 2000 - 1000;
-  y = y + shift[0];
-}
\ No newline at end of file
+  y = y + obj_shift(seed);
+}
@@ -7,7 +7,7 @@
 
 #include "IOHprofiler_common.h"
 #include "IOHprofiler_random.h"
-#include "coco_transformation.hpp"
+#include "IOHprofiler_packed_bits.h"
 
 /// \brief A class consisting of transformation methods.
 class IOHprofiler_transformation {
@@ -20,6 +20,8 @@ public:
   /// For instance_id in ]50,100], sigma function is applied.
   void variables_transformation(std::vector<int> &x, const int problem_id, const int instance_id, const std::string problem_type);
 
+  /// The transformations of BBOB problems depend on the data of their instance, and are
+  /// applied by BBOB_problem, so no transformation is applied to real variables here.
   void variables_transformation(std::vector<double> &x, const int problem_id, const int instance_id, const std::string problem_type);
 
   /// \fn void objectives_transformation(const std::vector<int> &x, std::vector<double> &y, const int problem_id, const int instance_id, const std::string problem_type)
@@ -27,12 +29,24 @@ public:
   void objectives_transformation(const std::vector<int> &x, std::vector<double> &y, const int problem_id, const int instance_id, const std::string problem_type);
 
   void objectives_transformation(const std::vector<double> &x, std::vector<double> &y, const int problem_id, const int instance_id, const std::string problem_type);
+
+  /// \fn std::vector<int> variables_positions(const int number_of_variables, const int problem_id, const int instance_id, const std::string problem_type)
+  /// \brief Positions of variables after the transformation on variables.
+  ///
+  /// The i-th variable is moved to position 'positions[i]' by variables_transformation,
+  /// so that flipping it flips the transformed variable at that position.
+  std::vector<int> variables_positions(const int number_of_variables, const int problem_id, const int instance_id, const std::string problem_type);
   
   /// \fn xor_compute(const int x1, const int x2)
   ///
   /// Exclusive or operation on x1, x2. x1 and x2 should either 0 or 1.
   static int xor_compute(const int x1, const int x2);
 
+  /// \fn xor_mask(const int n, const int seed)
+  ///
+  /// The uniformly random bit string used by transform_vars_xor.
+  static std::vector<int> xor_mask(const int n, const int seed);
+
   /// \fn transform_vars_xor(std::vector<int> &x, const int seed)
   ///
   /// Applying xor operations on x with a uniformly random bit string.
@@ -40,11 +54,24 @@ public:
 
   static int sigma_compute(const std::vector<int> &x, const int pos);
 
+  /// \fn sigma_index(const int N, const int seed)
+  ///
+  /// The permutation used by transform_vars_sigma, which moves x[index[i]] to position i.
+  static std::vector<int> sigma_index(const int N, const int seed);
+
   /// \fn transform_vars_sigma(std::vector<int> &x, const int seed)
   ///
   /// Disrupting the order of x.
   void transform_vars_sigma(std::vector<int> &x, const int seed);
 
+  /// \fn double obj_scale(const int seed)
+  /// \brief The factor 'a' of transform_obj_scale.
+  static double obj_scale(const int seed);
+
+  /// \fn double obj_shift(const int seed)
+  /// \brief The offset 'b' of transform_obj_shift.
+  static double obj_shift(const int seed);
+
   /// \fn void transform_obj_scale(std::vector<double> &y, const int seed)
   /// \brief transformation 'a * f(x)'.
   void transform_obj_scale(std::vector<double> &y, const int seed);
@@ -62,4 +89,158 @@ public:
   void transform_obj_shift(double &y, const int seed);
 };
 
+/// \brief The transformations of a pseudo-Boolean problem instance, computed once.
+///
+/// The xor mask, the permutation of sigma, and the constants of 'a * f(x) + b' only depend on
+/// the instance id and the number of variables. They are computed by prepare() when the instance
+/// changes and applied without regenerating random numbers, with the same results as the methods
+/// of IOHprofiler_transformation. Applying them does not change the tables, so several threads
+/// may apply them at the same time, each with its own buffer.
+template <class InputType> class IOHprofiler_transformation_tables {
+public:
+  IOHprofiler_transformation_tables() :
+    pseudo_Boolean(false),
+    objectives_flag(false),
+    scale(1.0),
+    shift(0.0) {}
+
+  /// \fn void prepare(const int number_of_variables, const int instance_id, const std::string problem_type)
+  /// \brief Computes the tables of an instance. Other problem types than pseudo-Boolean problems are not handled.
+  void prepare(const int number_of_variables, const int instance_id, const std::string problem_type) {
+    this->pseudo_Boolean = (problem_type == "pseudo_Boolean_problem");
+    this->xor_mask.clear();
+    this->packed_xor_mask.clear();
+    this->sigma_index.clear();
+    this->positions.clear();
+    this->objectives_flag = false;
+    this->scale = 1.0;
+    this->shift = 0.0;
+    if (!this->pseudo_Boolean || number_of_variables < 0) {
+      return;
+    }
+
+    if (instance_id > 1 && instance_id <= 50) {
+      this->xor_mask = IOHprofiler_transformation::xor_mask(number_of_variables,instance_id);
+      this->packed_xor_mask.assign(packed_words(number_of_variables),0);
+      for (int i = 0; i != number_of_variables; ++i) {
+        if (this->xor_mask[i] != 0) {
+          packed_set(this->packed_xor_mask.data(),i);
+        }
+      }
+    } else if (instance_id > 50 && instance_id <= 100) {
+      this->sigma_index = IOHprofiler_transformation::sigma_index(number_of_variables,instance_id);
+    }
+    this->positions.resize(number_of_variables);
+    for (int i = 0; i != number_of_variables; ++i) {
+      this->positions[this->sigma_index.empty() ? i : this->sigma_index[i]] = i;
+    }
+
+    if (instance_id > 1) {
+      this->objectives_flag = true;
+      this->scale = IOHprofiler_transformation::obj_scale(instance_id);
+      this->shift = IOHprofiler_transformation::obj_shift(instance_id);
+    }
+  }
+
+  /// \fn bool handles_problem() const
+  /// \brief Whether the tables apply to the problem, i.e., it is a pseudo-Boolean problem.
+  bool handles_problem() const {
+    return this->pseudo_Boolean;
+  }
+
+  /// \fn bool transforms_variables() const
+  /// \brief Whether the transformation on variables changes the variables of the instance.
+  bool transforms_variables() const {
+    return !this->xor_mask.empty() || !this->sigma_index.empty();
+  }
+
+  /// \fn void variables_transformation(const std::vector<InputType> &x, std::vector<InputType> &y) const
+  /// \brief Transformation on variables, writing the transformed x into y.
+  ///
+  /// y is resized to x.size(), and thus not reallocated if it is reused for solutions of the same size.
+  void variables_transformation(const std::vector<InputType> &x, std::vector<InputType> &y) const {
+    const std::size_t n = x.size();
+    if (!this->xor_mask.empty() && n == this->xor_mask.size()) {
+      y.resize(n);
+      const int *mask = this->xor_mask.data();
+      const InputType *v = x.data();
+      InputType *w = y.data();
+      for (std::size_t i = 0; i != n; ++i) {
+        w[i] = (InputType) (v[i] != mask[i]);
+      }
+    } else if (!this->sigma_index.empty() && n == this->sigma_index.size()) {
+      y.resize(n);
+      const int *index = this->sigma_index.data();
+      const InputType *v = x.data();
+      InputType *w = y.data();
+      for (std::size_t i = 0; i != n; ++i) {
+        w[i] = v[index[i]];
+      }
+    } else {
+      y.assign(x.begin(),x.end());
+    }
+  }
+
+  /// \fn void variables_transformation_packed(const uint64_t *x, const std::size_t n, uint64_t *y) const
+  /// \brief Transformation on the n variables packed into x (see IOHprofiler_packed_bits.h), writing the transformed x into y.
+  ///
+  /// The bits of x after the last variable are ignored, and those of y are set to 0.
+  void variables_transformation_packed(const uint64_t *x, const std::size_t n, uint64_t *y) const {
+    const std::size_t words = packed_words(n);
+    if (words == 0) {
+      return;
+    }
+    if (!this->packed_xor_mask.empty() && n == this->xor_mask.size()) {
+      const uint64_t *mask = this->packed_xor_mask.data();
+      for (std::size_t w = 0; w != words; ++w) {
+        y[w] = x[w] ^ mask[w];
+      }
+    } else if (!this->sigma_index.empty() && n == this->sigma_index.size()) {
+      const int *index = this->sigma_index.data();
+      for (std::size_t w = 0; w != words; ++w) {
+        y[w] = 0;
+      }
+      for (std::size_t i = 0; i != n; ++i) {
+        if (packed_get(x,index[i])) {
+          packed_set(y,i);
+        }
+      }
+    } else {
+      for (std::size_t w = 0; w != words; ++w) {
+        y[w] = x[w];
+      }
+    }
+    y[words - 1] &= packed_tail_mask(n);
+  }
+
+  /// \fn void objectives_transformation(std::vector<double> &y) const
+  /// \brief Transformation on objectives (a * f(x) + b).
+  void objectives_transformation(std::vector<double> &y) const {
+    if (this->objectives_flag) {
+      for (std::size_t i = 0; i < y.size(); ++i) {
+        y[i] = y[i] * this->scale;
+      }
+      for (std::size_t i = 0; i < y.size(); ++i) {
+        y[i] = y[i] + this->shift;
+      }
+    }
+  }
+
+  /// \fn const std::vector<int> &variables_positions() const
+  /// \brief Positions of variables after the transformation on variables (see IOHprofiler_transformation::variables_positions).
+  const std::vector<int> &variables_positions() const {
+    return this->positions;
+  }
+
+private:
+  bool pseudo_Boolean;
+  std::vector<int> xor_mask; /// < the xor mask for instances in ]1,50].
+  std::vector<uint64_t> packed_xor_mask; /// < xor_mask packed into words of 64 bits.
+  std::vector<int> sigma_index; /// < the permutation for instances in ]50,100].
+  std::vector<int> positions; /// < the inverse permutation of sigma_index.
+  bool objectives_flag; /// < whether the objectives are transformed, for instances > 1.
+  double scale;
+  double shift;
+};
+
 #endif //IOHPROFILER_TRANSFORMATION_H
\ No newline at end of file
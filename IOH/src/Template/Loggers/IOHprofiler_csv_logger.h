@@ -27,6 +27,11 @@ public:
 
   void activate_logger();
 
+  /// \fn get_folder_name()
+  ///
+  /// The name of the output folder, which is renamed by activate_logger() if it exists already.
+  std::string get_folder_name() const;
+
   void clear_logger();
 
   void add_dynamic_attribute(const std::vector<std::shared_ptr<double> > &attributes);
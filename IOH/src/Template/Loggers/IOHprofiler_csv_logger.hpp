@@ -73,6 +73,11 @@ void IOHprofiler_csv_logger<T>::activate_logger() {
   openIndex();
 }
 
+template<class T>
+std::string IOHprofiler_csv_logger<T>::get_folder_name() const {
+  return this->folder_name;
+}
+
 template<class T>
 int IOHprofiler_csv_logger<T>::openIndex() { 
   std::string experiment_folder_name = IOHprofiler_experiment_folder_name();
@@ -0,0 +1,109 @@
+/**
+ * The frequency table of the (1+1)-FEA, storing the encounter
+ * frequency of objective values.
+ *
+ * Author: Thomas Weise
+ *         Institute of Applied Optimization
+ *         Hefei University
+ *         Hefei, Anhui, China
+ * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
+ */
+#include "frequencytable.h"
+#include <string.h>
+
+static const size_t EMPTY_SLOT = SIZE_MAX;
+
+// the bit pattern of an objective value, with the same key for
+// values which compare as equal (0.0 and -0.0) and for all NaNs
+static inline uint64_t key_of(const double y) {
+  double value = y;
+  if (value == 0.0) value = 0.0;
+  if (value != value) value = std::numeric_limits<double>::quiet_NaN();
+  uint64_t key;
+  memcpy(&key, &value, sizeof(key));
+  return key;
+}
+
+// Fibonacci hashing of the key, whose high bits become the slot
+static inline size_t slot_of(const uint64_t key, const unsigned int shift) {
+  return (size_t) (((key ^ (key >> 32)) * 0x9E3779B97F4A7C15ULL) >> shift);
+}
+
+FrequencyTable::FrequencyTable() :
+    lowerbound_(0),
+    dense_(0),
+    used_(0),
+    shift_(64) {
+}
+
+void FrequencyTable::reset(const bool dense, const long long lowerbound,
+    const long long upperbound) {
+  this->lowerbound_ = lowerbound;
+  this->dense_ = 0;
+  if (dense && (lowerbound <= upperbound)
+      && (((unsigned long long) (upperbound - lowerbound))
+          < FREQUENCY_TABLE_DENSE_MAX)) {
+    this->dense_ = (size_t) (upperbound - lowerbound) + 1;
+  }
+  this->counts_.assign(this->dense_, 0);
+
+  Slot empty;
+  empty.key = 0;
+  empty.handle = EMPTY_SLOT;
+  this->slots_.assign(FREQUENCY_TABLE_INITIAL_SLOTS, empty);
+  this->used_ = 0;
+  this->shift_ = 64;
+  for (size_t size = FREQUENCY_TABLE_INITIAL_SLOTS; size > 1; size >>= 1) {
+    --this->shift_;
+  }
+}
+
+size_t FrequencyTable::find(const double raw, const double y) {
+// integer raw objective values within the range are counted directly
+  if (this->dense_ > 0) {
+    const double index = raw - ((double) this->lowerbound_);
+    if ((index >= 0.0) && (index < ((double) this->dense_))) {
+      const size_t handle = (size_t) index;
+      if (((double) handle) == index) return handle;
+    }
+  }
+
+// all other values are looked up in the hash table
+  const uint64_t key = key_of(y);
+  const size_t mask = this->slots_.size() - 1;
+  for (size_t i = slot_of(key, this->shift_);; i = (i + 1) & mask) {
+    Slot &slot = this->slots_[i];
+    if (slot.handle == EMPTY_SLOT) {
+// completely new: store frequency 0
+      slot.key = key;
+      slot.handle = this->counts_.size();
+      this->counts_.push_back(0);
+      const size_t handle = slot.handle;
+      if ((++this->used_) > (this->slots_.size() >> 1)) {
+        this->grow();
+      }
+      return handle;
+    }
+    if (slot.key == key) return slot.handle;
+  }
+}
+
+void FrequencyTable::grow() {
+  vector<Slot> old;
+  old.swap(this->slots_);
+  Slot empty;
+  empty.key = 0;
+  empty.handle = EMPTY_SLOT;
+  this->slots_.assign(old.size() << 1, empty);
+  --this->shift_;
+
+  const size_t mask = this->slots_.size() - 1;
+  for (size_t j = 0; j < old.size(); ++j) {
+    if (old[j].handle == EMPTY_SLOT) continue;
+    size_t i = slot_of(old[j].key, this->shift_);
+    while (this->slots_[i].handle != EMPTY_SLOT) {
+      i = (i + 1) & mask;
+    }
+    this->slots_[i] = old[j];
+  }
+}
@@ -0,0 +1,80 @@
+/**
+ * The frequency table of the (1+1)-FEA, storing the encounter
+ * frequency of objective values.
+ *
+ * Each objective value is mapped to a handle of its counter once
+ * per step, so that updating and comparing the frequencies of the
+ * current and the new solution does not need further lookups.
+ *
+ * - If the problem reports that all its raw objective values are
+ *   integers within a small enough range, the counters of these
+ *   values are stored in a dense array indexed by the raw
+ *   objective value. Since the objective transformation of the
+ *   instances is bijective, counting raw values is the same as
+ *   counting the transformed ones.
+ * - All other values are stored in an open-addressing hash table
+ *   with linear probing, which is keyed on the bit pattern of the
+ *   transformed objective value and stores the keys and handles
+ *   in one flat array.
+ *
+ * Author: Thomas Weise
+ *         Institute of Applied Optimization
+ *         Hefei University
+ *         Hefei, Anhui, China
+ * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
+ */
+
+#ifndef _FREQUENCYTABLE_H_
+#define _FREQUENCYTABLE_H_
+#include "common.h"
+#include <stdint.h>
+
+// the largest number of integer objective values stored in a dense array
+#define FREQUENCY_TABLE_DENSE_MAX (1ULL << 22)
+// the initial number of slots of the hash table, must be a power of 2
+#define FREQUENCY_TABLE_INITIAL_SLOTS 1024
+
+class FrequencyTable {
+public:
+  FrequencyTable();
+
+  ~FrequencyTable() {}
+  FrequencyTable(const FrequencyTable&) = delete;
+  FrequencyTable &operator = (const FrequencyTable&) = delete;
+
+  // clear the table
+  // dense = whether all raw objective values are integers
+  //         within [lowerbound, upperbound]
+  void reset(const bool dense, const long long lowerbound,
+      const long long upperbound);
+
+  // get the handle of the counter of an objective value, which is
+  // created with frequency 0 if the value has not been seen before
+  // raw = the raw objective value
+  // y = the transformed objective value
+  size_t find(const double raw, const double y);
+
+  // the frequency counter belonging to a handle
+  unsigned long long &operator [](const size_t handle) {
+    return this->counts_[handle];
+  }
+
+private:
+  struct Slot {
+    uint64_t key; /// < the bit pattern of the objective value
+    size_t handle; /// < the handle of its counter, or SIZE_MAX if empty
+  };
+
+  // double the number of slots and re-insert all keys
+  void grow();
+
+  long long lowerbound_; /// < the raw objective value of handle 0
+  size_t dense_; /// < the number of dense counters
+
+  vector<unsigned long long> counts_; /// < dense counters, then hashed ones
+  vector<Slot> slots_; /// < the hash table
+  size_t used_; /// < the number of occupied slots
+  unsigned int shift_; /// < 64 - log2(number of slots)
+};
+
+#endif
@@ -0,0 +1,259 @@
+/**
+ * Here we implement a lockstep execution of independent runs of the
+ * (1+1)-EA>0 (see opoealockstep.h).
+ *
+ * Author: Thomas Weise
+ *         Institute of Applied Optimization
+ *         Hefei University
+ *         Hefei, Anhui, China
+ * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
+ */
+#include "opoealockstep.h"
+
+// the state of the runs in lockstep, one entry per lane
+struct EaLockstepLanes {
+// the current solutions, which are mutated in place
+  std::vector<std::vector<int> > x;
+// the objective values of the current solutions
+  std::vector<double> y;
+// the bits flipped in the current step
+  std::vector<std::vector<int> > flips;
+// the random number generators of the runs
+  std::vector<mt19937_64> random;
+// the run performed by the lane
+  std::vector<unsigned long long> run;
+
+// remove the lane i by moving the last lane to its place
+  void remove(const size_t i) {
+    const size_t last = this->y.size() - 1;
+    if (i != last) {
+      std::swap(this->x[i], this->x[last]);
+      this->y[i] = this->y[last];
+      std::swap(this->flips[i], this->flips[last]);
+      this->random[i] = this->random[last];
+      this->run[i] = this->run[last];
+    }
+    this->x.pop_back();
+    this->y.pop_back();
+    this->flips.pop_back();
+    this->random.pop_back();
+    this->run.pop_back();
+  }
+};
+
+// the logging of the runs in lockstep: the evaluations of the first unfinished run are
+// recorded and logged directly, those of the runs after it are buffered until it finishes
+struct EaLockstepLog {
+  EaLockstepLog(shared_ptr<IOHprofiler_problem<int>> problem,
+      shared_ptr<IOHprofiler_csv_logger<int>> logger,
+      const unsigned long long runs) :
+      problem(problem), logger(logger), raw(runs), transformed(runs),
+      finished(runs, false), logged(0), evaluations(0), best_raw(0),
+      best_transformed(0) {
+    this->start();
+  }
+
+// record the evaluation of run r
+  void record(const unsigned long long r, const double y_raw, const double y) {
+    if (r == this->logged) {
+      this->write(y_raw, y);
+    } else {
+      this->raw[r].push_back(y_raw);
+      this->transformed[r].push_back(y);
+    }
+  }
+
+// the run r is finished, so the buffered runs after it can be logged
+  void finish(const unsigned long long r) {
+    this->finished[r] = true;
+    while ((this->logged < this->finished.size())
+        && this->finished[this->logged]) {
+      if ((++this->logged) >= this->finished.size()) {
+        return;
+      }
+      this->start();
+      std::vector<double> &raw_r = this->raw[this->logged];
+      std::vector<double> &transformed_r = this->transformed[this->logged];
+      for (size_t e = 0; e < transformed_r.size(); e++) {
+        this->write(raw_r[e], transformed_r[e]);
+      }
+      std::vector<double>().swap(raw_r);
+      std::vector<double>().swap(transformed_r);
+    }
+  }
+
+private:
+// start logging the run 'logged'
+  void start() {
+    this->problem->reset_problem();
+    this->logger->track_problem(*this->problem);
+    this->evaluations = 0;
+    this->best_raw = std::numeric_limits<double>::lowest();
+    this->best_transformed = std::numeric_limits<double>::lowest();
+  }
+
+  void write(const double y_raw, const double y) {
+    if (y > this->best_transformed) {
+      this->best_raw = y_raw;
+      this->best_transformed = y;
+    }
+    this->problem->record_evaluation(y_raw, y);
+    this->logger->write_line(++this->evaluations, y_raw, this->best_raw, y,
+        this->best_transformed);
+  }
+
+  shared_ptr<IOHprofiler_problem<int>> problem;
+  shared_ptr<IOHprofiler_csv_logger<int>> logger;
+// the raw and transformed objective values of the buffered evaluations of each run
+  std::vector<std::vector<double> > raw;
+  std::vector<std::vector<double> > transformed;
+  std::vector<bool> finished;
+// the run which is logged directly
+  unsigned long long logged;
+  unsigned long long evaluations;
+  double best_raw;
+  double best_transformed;
+};
+
+void ea1p1_lockstep(shared_ptr<IOHprofiler_problem<int>> problem,
+    shared_ptr<IOHprofiler_csv_logger<int>> logger,
+    const unsigned long long eval_budget, const unsigned long long runs) {
+// check input variables
+  if (eval_budget <= 1) throw "eval_budget must be > 1";
+  if (!problem) throw "problem must not be null";
+  if (!logger) throw "logger must not be null";
+  if (runs < 1) throw "runs must be > 0";
+
+// n be the number of variables
+  const int n = problem->IOHprofiler_get_number_of_variables();
+  if (n <= 0) throw "number of variables must be positive";
+// the bit flip probability
+  const double p = 1.0 / ((double) n);
+  if ((!isfinite(p)) || (p <= 0.0) || (p >= 1.0)) throw "p must be from (0,1)";
+
+  problem->reset_problem();
+  const double optimum = problem->IOHprofiler_get_optimal()[0];
+
+// set up the lanes with their random initial solutions
+  EaLockstepLanes lanes;
+  lanes.x.resize(runs);
+  lanes.y.resize(runs);
+  lanes.flips.resize(runs);
+  lanes.random.resize(runs);
+  lanes.run.resize(runs);
+  uniform_real_distribution<double> uniform(0.0, 1.0);
+  for (unsigned long long r = 0; r < runs; r++) {
+    seed_seq seeds = {(unsigned) random_gen(), (unsigned) random_gen()};
+    lanes.random[r].seed(seeds);
+    lanes.run[r] = r;
+    lanes.x[r].resize(n);
+    for (int i = 0; i < n; i++) {
+      lanes.x[r][i] = (int) (2 * uniform(lanes.random[r]));
+    }
+  }
+
+  EaLockstepLog log(problem, logger, runs);
+  binomial_distribution<int> binomial(n, p);
+  uniform_int_distribution<int> position(0, n - 1);
+  std::vector<double> ynew_raw;
+  std::vector<double> ynew;
+
+// we evaluate the random initial solutions
+  problem->evaluate_detached(lanes.x, ynew_raw, ynew);
+  for (size_t i = lanes.y.size(); i-- > 0;) {
+    const unsigned long long r = lanes.run[i];
+    log.record(r, ynew_raw[i], ynew[i]);
+    lanes.y[i] = ynew[i];
+    if (ynew[i] == optimum) {
+      lanes.remove(i);
+      log.finish(r);
+    }
+  }
+
+// we perform iterations until either all runs discovered the optimum or the budget has been exhausted
+  unsigned long long int step = 1;
+  while (((++step) <= eval_budget) && (!lanes.y.empty())) {
+    const size_t active = lanes.y.size();
+
+// flip a binomially distributed number of bits, at least one, of each current solution
+    for (size_t i = 0; i < active; i++) {
+      mt19937_64 &random = lanes.random[i];
+      std::vector<int> &flips = lanes.flips[i];
+      int l;
+      do {
+        l = binomial(random);
+      } while (l == 0);
+      flips.clear();
+      while (flips.size() < (size_t) l) {
+        const int j = position(random);
+        if (std::find(flips.begin(), flips.end(), j) == flips.end()) {
+          flips.push_back(j);
+        }
+      }
+      for (size_t k = 0; k < flips.size(); k++) {
+        lanes.x[i][flips[k]] ^= 1;
+      }
+    }
+
+// evaluate the new candidate solutions together
+    problem->evaluate_detached(lanes.x, ynew_raw, ynew);
+
+// if a new solution is at least as good as the current one, accept it, otherwise revert it
+    for (size_t i = active; i-- > 0;) {
+      const unsigned long long r = lanes.run[i];
+      log.record(r, ynew_raw[i], ynew[i]);
+      if (ynew[i] >= lanes.y[i]) {
+        lanes.y[i] = ynew[i];
+      } else {
+        const std::vector<int> &flips = lanes.flips[i];
+        for (size_t k = 0; k < flips.size(); k++) {
+          lanes.x[i][flips[k]] ^= 1;
+        }
+      }
+      if (ynew[i] == optimum) {
+        lanes.remove(i);
+        log.finish(r);
+      }
+    }
+  }
+
+// the runs which did not discover the optimum have exhausted the budget
+  for (size_t i = 0; i < lanes.run.size(); i++) {
+    log.finish(lanes.run[i]);
+  }
+}
+
+// run the (1+1) ea with 'lanes' runs in lockstep
+void run_ea1p1_lockstep(const string folder_path,
+    shared_ptr<IOHprofiler_suite<int>> suite,
+    const unsigned long long eval_budget,
+    const unsigned long long independent_runs,
+    const unsigned long long rand_seed,
+    const unsigned long long lanes) {
+  if (folder_path.empty()) throw "folder path cannot be empty";
+  if (!suite) throw "suite cannot be null";
+  if (eval_budget <= 1) throw "eval_budget must be > 1";
+  if (independent_runs < 1) throw "independent_runs must be > 0";
+  if (lanes < 1) throw "lanes must be > 0";
+
+// limit the number of buffered evaluations, the first of the K runs is not buffered
+  const unsigned long long K = max(1ULL,
+      min(lanes, 1 + EA1P1_LOCKSTEP_MAX_BUFFERED / eval_budget));
+
+  const string algorithm_name = "opoea_lockstep";
+  std::shared_ptr<IOHprofiler_csv_logger<int>> logger(
+      new IOHprofiler_csv_logger<int>(folder_path, algorithm_name,
+          algorithm_name, algorithm_name));
+  logger->activate_logger();
+
+  random_gen.seed(rand_seed);
+  shared_ptr<IOHprofiler_problem<int> > problem;
+  while ((problem = suite->get_next_problem()) != nullptr) {
+    for (unsigned long long i = 0; i < independent_runs; i += K) {
+      ea1p1_lockstep(problem, logger, eval_budget,
+          min(K, independent_runs - i));
+    }
+  }
+
+  logger->clear_logger();
+}
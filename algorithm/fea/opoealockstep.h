@@ -0,0 +1,58 @@
+/**
+ * Here we implement a lockstep execution of independent runs of the
+ * (1+1)-EA>0 (see opoea.h).
+ *
+ * On small problems, a single step of the (1+1)-EA>0 takes only a few
+ * nanoseconds, and the overhead of recording and logging each evaluation
+ * dominates the runtime. In the lockstep mode, K independent runs of the
+ * same problem advance together:
+ *
+ * - The state of the runs (the current solutions, their objective values,
+ *   the random number generators) is stored in one array per component,
+ *   indexed by the lane of the run.
+ * - In each step, the offspring of all lanes are evaluated together
+ *   without touching the state of the problem.
+ * - A lane whose run discovers the optimum is removed from the active
+ *   lanes, the other lanes continue until the budget is exhausted.
+ * - The mutation flips a binomially distributed number of bits (at least
+ *   one) in place, and reverts them if the offspring is rejected.
+ *
+ * Each run has its own random number generator, whose seed is drawn from
+ * the random generator of the algorithm in the order of the runs. The
+ * results thus do not depend on K.
+ * The evaluations of the first unfinished run are recorded and logged
+ * directly, while those of the later runs are buffered and logged as soon as
+ * all runs before them have finished. The logs are thus the same as if the
+ * runs were performed one after the other.
+ *
+ * Author: Thomas Weise
+ *         Institute of Applied Optimization
+ *         Hefei University
+ *         Hefei, Anhui, China
+ * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
+ */
+
+#ifndef _OPOEALOCKSTEP_H_
+#define _OPOEALOCKSTEP_H_
+#include "common.h"
+
+// the default number of runs performed in lockstep
+#define EA1P1_LOCKSTEP_LANES 16
+// the maximum number of evaluations buffered for the runs in lockstep, if the
+// budget exceeds it, the runs are performed one after the other without buffering
+#define EA1P1_LOCKSTEP_MAX_BUFFERED (1ULL << 25)
+
+// perform 'runs' independent runs of the (1+1)-EA>0 on the problem in
+// lockstep and log them one after the other
+void ea1p1_lockstep(shared_ptr<IOHprofiler_problem<int>> problem,
+    shared_ptr<IOHprofiler_csv_logger<int>> logger,
+    const unsigned long long eval_budget, const unsigned long long runs);
+
+void run_ea1p1_lockstep(const string folder_path,
+    shared_ptr<IOHprofiler_suite<int>> suite,
+    const unsigned long long eval_budget,
+    const unsigned long long independent_runs,
+    const unsigned long long rand_seed,
+    const unsigned long long lanes);
+
+#endif
@@ -29,8 +29,8 @@
  * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
  */
 
-#include <tr1/unordered_map>
 #include "opofea.h"
+#include "frequencytable.h"
 
 void fea1p1(shared_ptr<IOHprofiler_problem<int>> problem,
     shared_ptr<IOHprofiler_csv_logger<int>> logger,
@@ -51,13 +51,17 @@ void fea1p1(shared_ptr<IOHprofiler_problem<int>> problem,
   std::vector<int> xcur;
 // xnew is the new candidate solution generated in each step
   std::vector<int> xnew;
-// ycur is the objective value of the current solution
-  double ycur = std::numeric_limits<double>::infinity();
 // ynew is the objective value of the new solution
   double ynew = std::numeric_limits<double>::infinity();
 
 // H is the frequency table, storing the encounter frequency of objective values
-  std::tr1::unordered_map<double, unsigned long long> H;
+  FrequencyTable H;
+  H.reset(problem->IOHprofiler_has_integer_objective_range(),
+      problem->IOHprofiler_get_integer_objective_lowerbound(),
+      problem->IOHprofiler_get_integer_objective_upperbound());
+// hcur and hnew are the handles of the frequencies of the current and new solution
+  size_t hcur;
+  size_t hnew;
 
 // first we generate the random initial solution
   xcur.reserve(n);
@@ -66,8 +70,8 @@ void fea1p1(shared_ptr<IOHprofiler_problem<int>> problem,
   }
 
 // we evaluate the random initial solution
-  ycur = problem->evaluate(xcur);
-  H[ycur] = 0; //and initialize its frequency
+  const double yfirst = problem->evaluate(xcur);
+  hcur = H.find(problem->IOHprofiler_get_last_raw_objective(), yfirst); //and initialize its frequency
   logger->do_log(problem->loggerInfo());
 
 // we perform iterations until either the optimum is discovered or the budget has been exhausted
@@ -92,16 +96,14 @@ void fea1p1(shared_ptr<IOHprofiler_problem<int>> problem,
     ynew = problem->evaluate(xnew);
     logger->do_log(problem->loggerInfo());
 
-// is it completely new?
-    if (H.find(ynew) == H.end()) {
-      H[ynew] = 0; // store frequency 0
-    }
+// find its frequency (stored as 0 if it is completely new)
+    hnew = H.find(problem->IOHprofiler_get_last_raw_objective(), ynew);
 // update the frequencies of both solutions
-    ++H[ycur];
-    ++H[ynew];
+    ++H[hcur];
+    ++H[hnew];
 // if the new solution has a lower or equal frequency, take it
-    if (H[ynew] <= H[ycur]) {
-      ycur = ynew;
+    if (H[hnew] <= H[hcur]) {
+      hcur = hnew;
       xcur = xnew;
     }
   }
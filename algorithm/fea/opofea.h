@@ -33,6 +33,12 @@
 #define _OPOFEA_H_
 #include "common.h"
 
+// perform a single run of the (1+1)-FEA on the problem, which must have been
+// reset and be tracked by the logger
+void fea1p1(shared_ptr<IOHprofiler_problem<int>> problem,
+    shared_ptr<IOHprofiler_csv_logger<int>> logger,
+    const unsigned long long eval_budget);
+
 void run_fea1p1(const string folder_path,
     shared_ptr<IOHprofiler_suite<int>> suite,
     const unsigned long long eval_budget,
@@ -21,13 +21,38 @@
 #include <assert.h>
 #include <IOHprofiler_all_suites.hpp>
 #include <IOHprofiler_csv_logger.h>
+#include <IOHprofiler_evaluator.h>
 //#include <IOHprofiler_ecdf_logger.h>
 
 using namespace std;
 
-static default_random_engine random_gen(1);
-static normal_distribution<double> normal_dis(0,1);
-static uniform_real_distribution<double> uniform_dis(0.0,1.0);
+/// The random generators are per translation unit and per thread, so runs executed
+/// concurrently on different threads do not share them.
+static thread_local default_random_engine random_gen(1);
+static thread_local normal_distribution<double> normal_dis(0,1);
+static thread_local uniform_real_distribution<double> uniform_dis(0.0,1.0);
+
+/// \fn random_seeders()
+/// \brief The functions seeding the random generators of all translation units.
+inline vector<void (*)(unsigned)> &random_seeders() {
+  static vector<void (*)(unsigned)> seeders;
+  return seeders;
+}
+
+static void seed_random_gen(unsigned seed) {
+  random_gen.seed(seed);
+  normal_dis.reset();
+}
+
+static const bool random_gen_registered = (random_seeders().push_back(seed_random_gen), true);
+
+/// \fn seed_random_generators()
+/// \brief Seeds the random generators of all translation units on the calling thread.
+inline void seed_random_generators(unsigned seed) {
+  for (size_t i = 0; i != random_seeders().size(); ++i) {
+    random_seeders()[i](seed);
+  }
+}
 
 enum optimizationType {
   MINIMIZATION = 0,
@@ -59,6 +59,39 @@ double GreedyHillClimber::Evaluate(vector<int> &x) {
   return result;
 }
 
+double GreedyHillClimber::EvaluateFlip(const size_t i) {
+  double result;
+  this->parent_[i] = 1 - this->parent_[i];
+  result = this->problem_->evaluate_flip(i);
+  if (this->csv_logger_ != nullptr) {
+    this->csv_logger_->do_log(this->problem_->loggerInfo());
+  }
+
+  ++this->evaluation_;
+
+  if (Opt == optimizationType::MAXIMIZATION) {
+    if (result > this->best_found_fitness_) {
+      this->best_found_fitness_ = result;
+      this->best_individual_ = this->parent_;
+    }
+  } else {
+    if (result < this->best_found_fitness_) {
+      this->best_found_fitness_ = result;
+      this->best_individual_ = this->parent_;
+    }
+  }
+  return result;
+}
+
+void GreedyHillClimber::RevertFlip(const size_t i) {
+  this->parent_[i] = 1 - this->parent_[i];
+}
+
+void GreedyHillClimber::AcceptFlip(const size_t i, const double fitness) {
+  this->problem_->accept_flip(i);
+  this->parent_fitness_ = fitness;
+}
+
 void GreedyHillClimber::SetSeed(unsigned seed) {
   random_gen.seed(seed);
 }
@@ -72,6 +105,10 @@ void GreedyHillClimber::set_independent_runs(const size_t independent_runs) {
   this->independent_runs_ = independent_runs;
 }
 
+void GreedyHillClimber::set_neighbourhood_scan(const neighbourhood_scan scan) {
+  this->scan_ = scan;
+}
+
 void GreedyHillClimber::set_parent(const vector< int > &parent) {
   this->parent_ = parent;
 }
@@ -140,28 +177,75 @@ size_t GreedyHillClimber::get_generation() {
   return this->generation_;
 }
 
+neighbourhood_scan GreedyHillClimber::get_neighbourhood_scan() const {
+  return this->scan_;
+}
+
 void GreedyHillClimber::DoGreedyHillClimber() {
   this->Preparation();
   
   this->Initialization();
+  this->problem_->start_flips(this->parent_);
+  const size_t n = this->get_dimension();
+
+  if (this->scan_ == BESTIMPROVEMENT) {
+    while (!this->Termination()) {
+      ++this->generation_;
+
+      // Evaluate all neighbours, and remember the best one.
+      size_t best_index = n;
+      double best_fitness = numeric_limits<double>::lowest();
+      for (size_t i = 0; i != n && !this->Termination(); ++i) {
+        this->offspring_fitness_ = this->EvaluateFlip(i);
+        this->RevertFlip(i);
+        if (best_index == n || this->offspring_fitness_ > best_fitness) {
+          best_index = i;
+          best_fitness = this->offspring_fitness_;
+        }
+      }
+
+      if (best_index == n || best_fitness < this->parent_fitness_) {
+        // A strict local optimum is never left.
+        break;
+      }
+      this->parent_[best_index] = 1 - this->parent_[best_index];
+      this->AcceptFlip(best_index, best_fitness);
+    }
+    return;
+  }
+
   size_t flip_index = 0;
+  if (this->scan_ == RANDOMORDER) {
+    this->order_.resize(n);
+    flip_index = n;
+  }
   while (!this->Termination()) {
     ++this->generation_;
     
-    this->offspring_.clear();
-    this->offspring_ = this->parent_;
-  
-    // Filp the bit at flip_index.
-    this->offspring_[flip_index] = (this->offspring_[flip_index] + 1) % 2;
-    if(++flip_index >= this->get_dimension()) {
+    size_t i = flip_index;
+    if (this->scan_ == RANDOMORDER) {
+      // Start a new pass with a new random permutation of the bits.
+      if (flip_index >= n) {
+        for (size_t k = 0; k != n; ++k) {
+          this->order_[k] = k;
+        }
+        for (size_t k = n - 1; k > 0; --k) {
+          swap(this->order_[k], this->order_[(size_t)(uniform_random() * (k + 1))]);
+        }
+        flip_index = 0;
+      }
+      i = this->order_[flip_index++];
+    } else if(++flip_index >= n) {
       flip_index = 0;
     }
-    
-    this->offspring_fitness_ = this->Evaluate(this->offspring_);
+
+    // Filp the bit at i.
+    this->offspring_fitness_ = this->EvaluateFlip(i);
 
     if (this->offspring_fitness_ >= this->parent_fitness_) {
-      this->parent_ = this->offspring_;
-      this->parent_fitness_ = this->offspring_fitness_;
+      this->AcceptFlip(i, this->offspring_fitness_);
+    } else {
+      this->RevertFlip(i);
     }
   }
 }
@@ -190,6 +274,11 @@ void GreedyHillClimber::run(shared_ptr<IOHprofiler_suite<int> > suite) {
 
 void GreedyHillClimber::run(string folder_path, string folder_name, shared_ptr<IOHprofiler_suite<int> > suite, int eval_budget, int independent_runs, unsigned rand_seed) {
   string algorithm_name = "gHC";
+  if (this->scan_ == RANDOMORDER) {
+    algorithm_name = "gHC_random";
+  } else if (this->scan_ == BESTIMPROVEMENT) {
+    algorithm_name = "gHC_best";
+  }
   std::shared_ptr<IOHprofiler_csv_logger<int>> logger(new IOHprofiler_csv_logger<int>(folder_path,folder_name,algorithm_name,algorithm_name) );
   logger->activate_logger();
   this->AssignLogger(logger);
@@ -4,7 +4,13 @@
 /// (1+1) greedy hill climber algorithm goes throught the string from left to right,
 /// flipping exactly one bit per iteration, and accepting the offspring if it
 /// is as least as good as its parent.
-/// 
+///
+/// The bit is flipped in the parent in place and flipped back if the offspring
+/// is rejected. The offspring is evaluated by the single-bit flip evaluation of the
+/// problem, which only computes the change caused by the flip if the problem supports it.
+/// Besides the left-to-right scan, the neighbourhood can be scanned in a random order
+/// (a new permutation for each pass), or completely in each iteration, accepting the
+/// best neighbour (best improvement).
 ///
 /// \author Furong Ye
 /// \date 2020-11-23
@@ -14,9 +20,16 @@
 
 #include "common.h"
 
+enum neighbourhood_scan {
+  FIRSTIMPROVEMENT = 1, /// < flipping the bits from left to right, accepting each offspring as least as good as its parent.
+  RANDOMORDER = 2, /// < as FIRSTIMPROVEMENT, but going through the bits in a random order.
+  BESTIMPROVEMENT = 3 /// < evaluating all neighbours, accepting the best if it is as least as good as its parent.
+};
+
 class GreedyHillClimber {
 public:
-  GreedyHillClimber() {};
+  GreedyHillClimber(neighbourhood_scan scan = FIRSTIMPROVEMENT) :
+    scan_(scan) {};
 
   ~GreedyHillClimber() {}
   GreedyHillClimber(const GreedyHillClimber&) = delete;
@@ -42,6 +55,16 @@ public:
   
   double Evaluate(vector<int> &x);
 
+  /// \fn EvaluateFlip(const size_t i)
+  /// \brief Flipping the i-th bit of the parent in place and evaluating it.
+  ///
+  /// The flip must be undone by RevertFlip(i) or committed by AcceptFlip(i).
+  double EvaluateFlip(const size_t i);
+
+  void RevertFlip(const size_t i);
+
+  void AcceptFlip(const size_t i, const double fitness);
+
   void run(shared_ptr<IOHprofiler_suite<int> > suite);
 
   void run(string folder_path, string folder_name, shared_ptr<IOHprofiler_suite<int> > suite, int eval_budget, int independent_runs, unsigned rand_seed);
@@ -54,6 +77,7 @@ public:
   
   void set_evaluation_budget(const size_t evaluation_budget);
   void set_independent_runs(const size_t independent_runs);
+  void set_neighbourhood_scan(const neighbourhood_scan scan);
   void set_parent(const vector< int > &parent);
   void set_parent_fitness(const double parents_fitness);
   void set_offspring(const vector< int > &offspring);
@@ -73,6 +97,7 @@ public:
   double get_best_found_fitness();
   vector< int > get_best_individual();
   size_t get_generation();
+  neighbourhood_scan get_neighbourhood_scan() const;
   
 private:
  
@@ -88,6 +113,9 @@ private:
   size_t evluation_budget_; /// < budget for evaluations
   
   size_t independent_runs_; /// < number of independent runs.
+
+  neighbourhood_scan scan_; /// < the order of scanning the neighbourhood.
+  vector<size_t> order_; /// < the order of bits for RANDOMORDER.
   
   /// TODO: we assume the type of problem are integer only now.
   shared_ptr< IOHprofiler_problem<int> > problem_;
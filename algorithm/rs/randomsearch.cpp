@@ -1,4 +1,65 @@
 #include "randomsearch.h"
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/// < the number of candidates sampled and evaluated at once in bulk mode.
+#define RS_BULK_BLOCK 64
+/// < the maximum number of blocks a bulk worker may be ahead of the logger.
+#define RS_BULK_QUEUE 4
+
+/// A block of candidates sampled and evaluated in bulk mode.
+struct RandomSearchBlock {
+  vector<uint64_t> bits; /// < the candidates, packed into words of 64 bits.
+  vector<double> raw_objectives;
+  vector<double> transformed_objectives;
+};
+
+/// The blocks handed over from a bulk worker to the main thread.
+struct RandomSearchQueue {
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<RandomSearchBlock> blocks;
+};
+
+/// Sampling and evaluating the candidates of block 'index' of a run with the given seed.
+/// The candidates are evaluated packed, see IOHprofiler_problem::evaluate_packed_detached.
+static void bulk_sample_block(shared_ptr<IOHprofiler_problem<int> > problem, const unsigned long long seed,
+                              const unsigned long long index, const size_t size, RandomSearchBlock &block) {
+  const size_t n = problem->IOHprofiler_get_number_of_variables();
+  const size_t words = packed_words(n);
+  std::seed_seq seeds{(unsigned long) (seed & 0xffffffffULL), (unsigned long) (seed >> 32),
+                      (unsigned long) (index & 0xffffffffULL), (unsigned long) (index >> 32)};
+  std::mt19937_64 generator(seeds);
+
+  block.bits.resize(size * words);
+  for (size_t k = 0; k != size * words; ++k) {
+    block.bits[k] = generator();
+  }
+  problem->evaluate_packed_detached(block.bits.data(), size, block.raw_objectives, block.transformed_objectives);
+}
+
+/// A bulk worker sampling the blocks slot, slot + threads, slot + 2*threads, ...
+static void bulk_random_search_worker(shared_ptr<IOHprofiler_problem<int> > problem, const unsigned long long slot,
+                                      const unsigned long long threads, const unsigned long long seed,
+                                      const unsigned long long budget, RandomSearchQueue *queue, std::atomic<bool> *stop) {
+  for (unsigned long long index = slot; index * RS_BULK_BLOCK < budget && !stop->load(); index += threads) {
+    RandomSearchBlock block;
+    bulk_sample_block(problem, seed, index, (size_t) min((unsigned long long) RS_BULK_BLOCK, budget - index * RS_BULK_BLOCK), block);
+
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    queue->condition.wait(lock, [&]() { return stop->load() || queue->blocks.size() < RS_BULK_QUEUE; });
+    if (stop->load()) {
+      return;
+    }
+    queue->blocks.push_back(std::move(block));
+    lock.unlock();
+    queue->condition.notify_all();
+  }
+}
 
 bool RandomSearch::Termination() {
   if (!this->problem_->IOHprofiler_hit_optimal() && this->evaluation_ < this->evluation_budget_ ) {
@@ -68,6 +129,14 @@ void RandomSearch::set_independent_runs(const size_t independent_runs) {
   this->independent_runs_ = independent_runs;
 }
 
+void RandomSearch::set_bulk_sampling(const bool bulk) {
+  this->bulk_ = bulk;
+}
+
+void RandomSearch::set_threads(const unsigned threads) {
+  this->threads_ = threads;
+}
+
 void RandomSearch::set_solution(const vector< int > &solution) {
   this->solution_ = solution;
 }
@@ -120,6 +189,14 @@ size_t RandomSearch::get_generation() {
   return this->generation_;
 }
 
+bool RandomSearch::get_bulk_sampling() const {
+  return this->bulk_;
+}
+
+unsigned RandomSearch::get_threads() const {
+  return this->threads_;
+}
+
 void RandomSearch::DoRandomSearch() {
   this->Preparation();
   
@@ -138,18 +215,90 @@ void RandomSearch::DoRandomSearch() {
   }
 }
 
+void RandomSearch::DoBulkRandomSearch() {
+  this->Preparation();
+
+  const size_t words = packed_words(this->get_dimension());
+  const unsigned long long budget = this->evluation_budget_;
+  const unsigned long long blocks = (budget + RS_BULK_BLOCK - 1) / RS_BULK_BLOCK;
+  const unsigned long long threads = max(1ULL, min((unsigned long long) this->threads_, blocks));
+  /// the seed of the blocks of this run
+  const unsigned long long seed = (((unsigned long long) random_gen()) << 32) ^ ((unsigned long long) random_gen());
+
+  std::atomic<bool> stop(false);
+  vector<RandomSearchQueue> queues(threads);
+  vector<std::thread> workers;
+  if (threads > 1) {
+    workers.reserve(threads);
+    for (unsigned long long i = 0; i != threads; ++i) {
+      workers.push_back(std::thread(bulk_random_search_worker, this->problem_, i, threads, seed, budget, &queues[i], &stop));
+    }
+  }
+
+  RandomSearchBlock block;
+  for (unsigned long long index = 0; index != blocks && !this->Termination(); ++index) {
+    if (threads > 1) {
+      RandomSearchQueue &queue = queues[index % threads];
+      std::unique_lock<std::mutex> lock(queue.mutex);
+      queue.condition.wait(lock, [&]() { return !queue.blocks.empty(); });
+      block = std::move(queue.blocks.front());
+      queue.blocks.pop_front();
+      lock.unlock();
+      queue.condition.notify_all();
+    } else {
+      bulk_sample_block(this->problem_, seed, index, (size_t) min((unsigned long long) RS_BULK_BLOCK, budget - index * RS_BULK_BLOCK), block);
+    }
+
+    /// record and log the evaluations of the block in order
+    size_t k = 0;
+    for (; k != block.raw_objectives.size() && !this->Termination(); ++k) {
+      ++this->generation_;
+      const double result = this->problem_->record_evaluation(block.raw_objectives[k], block.transformed_objectives[k]);
+      if (this->csv_logger_ != nullptr) {
+        this->csv_logger_->do_log(this->problem_->loggerInfo());
+      }
+      ++this->evaluation_;
+      this->solution_fitness_ = result;
+
+      if ((Opt == optimizationType::MAXIMIZATION) ? (result > this->best_found_fitness_) : (result < this->best_found_fitness_)) {
+        this->best_found_fitness_ = result;
+        packed_unpack(&block.bits[k * words], this->best_individual_.size(), this->best_individual_.data());
+      }
+    }
+    if (k != 0) {
+      packed_unpack(&block.bits[(k - 1) * words], this->solution_.size(), this->solution_.data());
+    }
+  }
+
+  /// terminate all workers
+  stop = true;
+  for (unsigned long long i = 0; i != workers.size(); ++i) {
+    {
+      std::lock_guard<std::mutex> lock(queues[i].mutex);
+    }
+    queues[i].condition.notify_all();
+  }
+  for (unsigned long long i = 0; i != workers.size(); ++i) {
+    workers[i].join();
+  }
+}
+
 void RandomSearch::run(shared_ptr<IOHprofiler_suite<int> > suite) {
   while ((this->problem_ = suite->get_next_problem()) != nullptr) {
     size_t i = 0;
     while(++i <= this->independent_runs_) {
       size_t i = 0;
-      this->DoRandomSearch();
+      if (this->bulk_) {
+        this->DoBulkRandomSearch();
+      } else {
+        this->DoRandomSearch();
+      }
     }
   }
 }
 
 void RandomSearch::run(string folder_path, string folder_name, shared_ptr<IOHprofiler_suite<int> > suite, int eval_budget, int independent_runs, unsigned rand_seed) {
-  string algorithm_name = "random search";
+  string algorithm_name = this->bulk_ ? "random search bulk" : "random search";
   std::shared_ptr<IOHprofiler_csv_logger<int>> logger(new IOHprofiler_csv_logger<int>(folder_path,folder_name,algorithm_name,algorithm_name) );
   logger->activate_logger();
   this->AssignLogger(logger);
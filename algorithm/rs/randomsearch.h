@@ -2,7 +2,14 @@
 /// \brief Header file for class ghc.
 ///
 /// Random search generates candidates solution randomly.
-/// 
+///
+/// Besides sampling each bit by one random number, random search can sample in bulk:
+/// each call of a 64-bit random number generator fills 64 bits, and blocks of
+/// candidates are evaluated packed by the batch interface of the problem, optionally
+/// by several threads. The evaluations are still recorded and logged one by one
+/// in the order of the candidates. The candidates of a block only depend on the
+/// seed of the run and the index of the block, so the results do not depend on
+/// the number of threads.
 ///
 /// \author Furong Ye
 /// \date 2020-11-23
@@ -14,7 +21,9 @@
 
 class RandomSearch {
 public:
-  RandomSearch() {};
+  RandomSearch(const bool bulk = false, const unsigned threads = 1) :
+    bulk_(bulk),
+    threads_(threads) {};
 
   ~RandomSearch() {}
   RandomSearch(const RandomSearch&) = delete;
@@ -33,6 +42,13 @@ public:
   /// Loop{ random_sampling } -> ~Termination().
   /// The function is virtual, which allows users to implement their own algorithm.
   virtual void DoRandomSearch();
+
+  /// \fn DoBulkRandomSearch()
+  /// \brief Do function of the random search algorithm sampling in bulk.
+  ///
+  /// The order of processing functions is:
+  /// Loop{ sampling and evaluating a block, recording its evaluations } -> ~Termination().
+  virtual void DoBulkRandomSearch();
     
   void Preparation();
   
@@ -50,6 +66,8 @@ public:
   
   void set_evaluation_budget(const size_t evaluation_budget);
   void set_independent_runs(const size_t independent_runs);
+  void set_bulk_sampling(const bool bulk);
+  void set_threads(const unsigned threads);
   void set_solution(const vector< int > &solution);
   void set_solution_fitness(const double solution_fitness);
   void set_best_found_fitness(const double best_found_fitness);
@@ -65,6 +83,8 @@ public:
   double get_best_found_fitness();
   vector< int > get_best_individual();
   size_t get_generation();
+  bool get_bulk_sampling() const;
+  unsigned get_threads() const;
   
 private:
  
@@ -78,6 +98,9 @@ private:
   size_t evluation_budget_; /// < budget for evaluations
 
   size_t independent_runs_; /// < number of independent runs.
+
+  bool bulk_; /// < whether to sample and evaluate in bulk.
+  unsigned threads_; /// < number of threads evaluating blocks in bulk mode.
   
   /// TODO: we assume the type of problem are integer only now.
   shared_ptr< IOHprofiler_problem<int> > problem_;
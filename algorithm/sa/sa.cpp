@@ -45,44 +45,9 @@
  * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
  */
 #include "sa.h"
+#include "sacore.h"
 #include <math.h>
 
-// Compute the acceptance probability from DeltaE and the temperature
-// DeltaE must be positive
-inline static double p_accept(const double DeltaE, const double temperature) {
-  return exp(-DeltaE / temperature);
-}
-
-// Compute the temperature at a given step
-// Tstart = start temperatre
-// epsilon = temperature decrease parameter
-// step = step index; must be >= 1
-inline static double temperature(const double Tstart, const double epsilon,
-    const unsigned long long step) {
-  return Tstart * pow(1.0 - epsilon, step - 1);
-}
-
-// compute a temperature from a given DeltaE and acceptance probability P
-inline static double T_from_DeltaE_and_P(const double DeltaE, const double P) {
-  if ((!isfinite(DeltaE)) || (DeltaE <= 0.0))
-    throw "DeltaE must be positive and finite.";
-  if ((!isfinite(P)) || (P <= 0.0) || (P >= 1.0))
-    throw "P must be finite and from (0,1).";
-  return -DeltaE / log(P);
-}
-
-inline static double epsilon_from_T_and_step(const double Tstart,
-    const double Tstep, const unsigned long long step) {
-  if ((!isfinite(Tstart)) || (Tstart <= 0.0))
-    throw "Tstart must be positive and finite.";
-  if ((!isfinite(Tstep)) || (Tstep >= Tstart))
-    throw "Tstep must finite and > Tstart";
-  const double epsilon = 1.0 - pow(Tstep / Tstart, 1.0 / (step - 1));
-  if ((!isfinite(epsilon)) || (epsilon <= 0.0) || (epsilon >= 1.0))
-    throw "epsilon must be positive and from (0,1)";
-  return epsilon;
-}
-
 void simulated_annealing_exp(shared_ptr<IOHprofiler_problem<int>> problem,
     shared_ptr<IOHprofiler_csv_logger<int>> logger,
     const unsigned long long eval_budget) {
@@ -120,6 +85,10 @@ void simulated_annealing_exp(shared_ptr<IOHprofiler_problem<int>> problem,
   parameter_names.push_back("p");
   logger->set_parameters(parameters, parameter_names);
 
+// the core deciding about the acceptance of new solutions
+  SimulatedAnnealingCore core(uniform_random);
+  core.reset(Tstart, epsilon);
+
 // xcur is the current best candidate solution (based on frequency fitness)
   std::vector<int> xcur;
 // xnew is the new candidate solution generated in each step
@@ -162,9 +131,7 @@ void simulated_annealing_exp(shared_ptr<IOHprofiler_problem<int>> problem,
 
 // if new solution is at least as good as current one, accept it
 // otherwise: if check if it is acceptable at the current temperature
-    if ((ynew >= ycur)
-        || (uniform_random()
-            < p_accept(ycur - ynew, temperature(Tstart, epsilon, step)))) {
+    if (core.accept(ycur, ynew, step)) {
       ycur = ynew;
       xcur = xnew;
     }
@@ -49,6 +49,12 @@
 #define _SA_H_
 #include "common.h"
 
+// perform a single run of the simulated annealing algorithm on the problem,
+// which must have been reset and be tracked by the logger
+void simulated_annealing_exp(shared_ptr<IOHprofiler_problem<int>> problem,
+    shared_ptr<IOHprofiler_csv_logger<int>> logger,
+    const unsigned long long eval_budget);
+
 void run_simulated_annealing_exp(const string folder_path,
     shared_ptr<IOHprofiler_suite<int>> suite,
     const unsigned long long eval_budget,
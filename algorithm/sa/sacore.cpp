@@ -0,0 +1,97 @@
+/**
+ * The core shared by the Simulated Annealing algorithms with
+ * exponential temperature schedule (sa and sars).
+ *
+ * Author: Thomas Weise
+ *         Institute of Applied Optimization
+ *         Hefei University
+ *         Hefei, Anhui, China
+ * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
+ */
+#include "sacore.h"
+#include <math.h>
+
+SimulatedAnnealingCore::SimulatedAnnealingCore(double (*uniform)()) :
+    uniform_(uniform),
+    Tstart_(1.0),
+    epsilon_(0.0),
+    factor_(1.0),
+    step_(1),
+    T_(1.0),
+    band_(0),
+    Thigh_(1.0),
+    Tlow_(1.0),
+    table_band_(SA_INTEGER_DELTA_TABLE_SIZE, 0),
+    table_low_(SA_INTEGER_DELTA_TABLE_SIZE, 0.0),
+    table_high_(SA_INTEGER_DELTA_TABLE_SIZE, 0.0) {
+  if (!uniform) throw "uniform must not be null";
+}
+
+void SimulatedAnnealingCore::reset(const double Tstart, const double epsilon) {
+  if ((!isfinite(Tstart)) || (Tstart <= 0.0))
+    throw "Tstart must be positive and finite.";
+  if ((!isfinite(epsilon)) || (epsilon <= 0.0) || (epsilon >= 1.0))
+    throw "epsilon must be positive and from (0,1)";
+  this->Tstart_ = Tstart;
+  this->epsilon_ = epsilon;
+  this->factor_ = 1.0 - epsilon;
+  this->step_ = 1;
+  this->T_ = Tstart;
+  this->band_ = 0; // no band yet
+// invalidate all tabulated bounds
+  std::fill(this->table_band_.begin(), this->table_band_.end(), 0);
+}
+
+void SimulatedAnnealingCore::advance(const unsigned long long step) {
+  const unsigned long long band = ((step - 1) / SA_TEMPERATURE_BAND) + 1;
+  if (band != this->band_) {
+// entering a new band: compute its border temperatures exactly and
+// synchronize the incremental temperature
+    this->band_ = band;
+    this->Thigh_ = temperature(this->Tstart_, this->epsilon_,
+        ((band - 1) * SA_TEMPERATURE_BAND) + 1);
+    this->Tlow_ = temperature(this->Tstart_, this->epsilon_,
+        (band * SA_TEMPERATURE_BAND) + 1);
+    this->T_ = temperature(this->Tstart_, this->epsilon_, step);
+    this->step_ = step;
+    return;
+  }
+// within a band, the temperature decreases multiplicatively
+  for (; this->step_ < step; ++this->step_) {
+    this->T_ *= this->factor_;
+  }
+}
+
+bool SimulatedAnnealingCore::accept(const double ycur, const double ynew,
+    const unsigned long long step) {
+// if new solution is at least as good as current one, accept it
+// without drawing a random number
+  if (ynew >= ycur) {
+    return true;
+  }
+
+  const double DeltaE = ycur - ynew;
+  this->advance(step);
+  const double u = this->uniform_();
+
+// integer DeltaE: use the bounds of the band
+  if (DeltaE < SA_INTEGER_DELTA_TABLE_SIZE) {
+    const size_t k = (size_t) DeltaE;
+    if (DeltaE == (double) k) {
+      if (this->table_band_[k] != this->band_) {
+        this->table_band_[k] = this->band_;
+        this->table_low_[k] = p_accept(DeltaE, this->Tlow_);
+        this->table_high_[k] = p_accept(DeltaE, this->Thigh_);
+      }
+      if (u < this->table_low_[k]) return true;
+      if (u >= this->table_high_[k]) return false;
+      return u < p_accept(DeltaE, temperature(this->Tstart_, this->epsilon_, step));
+    }
+  }
+
+// other DeltaE: use the incremental temperature
+  const double P = p_accept(DeltaE, this->T_);
+  if (u < (P - SA_ACCEPTANCE_MARGIN)) return true;
+  if (u >= (P + SA_ACCEPTANCE_MARGIN)) return false;
+  return u < p_accept(DeltaE, temperature(this->Tstart_, this->epsilon_, step));
+}
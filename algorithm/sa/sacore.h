@@ -0,0 +1,127 @@
+/**
+ * The core shared by the Simulated Annealing algorithms with
+ * exponential temperature schedule (sa and sars).
+ *
+ * It bundles the automatic configuration helpers and the
+ * acceptance decision. The decision is exactly the one of
+ *
+ *   (ynew >= ycur) ||
+ *   (uniform() < exp(-(ycur - ynew) / (Tstart * pow(1 - epsilon, step - 1))))
+ *
+ * so that the trajectories for a given seed stay identical,
+ * but it avoids pow and exp in almost all steps:
+ *
+ * - The uniform random number is only drawn if the new
+ *   solution is worse, i.e., if acceptance is not certain.
+ * - The steps are divided into bands of SA_TEMPERATURE_BAND
+ *   steps. Since the temperature decreases monotonically,
+ *   the acceptance probability of an integer DeltaE within a
+ *   band is bounded by its values at the band borders. These
+ *   bounds are computed lazily once per band and DeltaE, and
+ *   a random number outside of them decides without any exp.
+ *   Most PBO objectives are integers, so this is the common
+ *   case.
+ * - For other DeltaE values, the temperature is advanced
+ *   multiplicatively (and synchronized at each band start).
+ *   Its acceptance probability only differs from the exact
+ *   one in the last digits, so it decides if the random
+ *   number is not too close to it.
+ * - Only in the remaining, extremely rare cases, the exact
+ *   acceptance probability is computed.
+ *
+ * Author: Thomas Weise
+ *         Institute of Applied Optimization
+ *         Hefei University
+ *         Hefei, Anhui, China
+ * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
+ */
+
+#ifndef _SACORE_H_
+#define _SACORE_H_
+#include "common.h"
+
+// the number of steps sharing the same acceptance bounds
+#define SA_TEMPERATURE_BAND 256
+// the number of integer DeltaE values with tabulated acceptance bounds
+#define SA_INTEGER_DELTA_TABLE_SIZE 256
+// the maximum difference of the incrementally computed acceptance
+// probability to the exact one which still allows a decision
+#define SA_ACCEPTANCE_MARGIN 1e-10
+
+// Compute the acceptance probability from DeltaE and the temperature
+// DeltaE must be positive
+inline static double p_accept(const double DeltaE, const double temperature) {
+  return exp(-DeltaE / temperature);
+}
+
+// Compute the temperature at a given step
+// Tstart = start temperatre
+// epsilon = temperature decrease parameter
+// step = step index; must be >= 1
+inline static double temperature(const double Tstart, const double epsilon,
+    const unsigned long long step) {
+  return Tstart * pow(1.0 - epsilon, step - 1);
+}
+
+// compute a temperature from a given DeltaE and acceptance probability P
+inline static double T_from_DeltaE_and_P(const double DeltaE, const double P) {
+  if ((!isfinite(DeltaE)) || (DeltaE <= 0.0))
+    throw "DeltaE must be positive and finite.";
+  if ((!isfinite(P)) || (P <= 0.0) || (P >= 1.0))
+    throw "P must be finite and from (0,1).";
+  return -DeltaE / log(P);
+}
+
+inline static double epsilon_from_T_and_step(const double Tstart,
+    const double Tstep, const unsigned long long step) {
+  if ((!isfinite(Tstart)) || (Tstart <= 0.0))
+    throw "Tstart must be positive and finite.";
+  if ((!isfinite(Tstep)) || (Tstep >= Tstart))
+    throw "Tstep must finite and > Tstart";
+  const double epsilon = 1.0 - pow(Tstep / Tstart, 1.0 / (step - 1));
+  if ((!isfinite(epsilon)) || (epsilon <= 0.0) || (epsilon >= 1.0))
+    throw "epsilon must be positive and from (0,1)";
+  return epsilon;
+}
+
+class SimulatedAnnealingCore {
+public:
+  // uniform = the uniform random number generator of the algorithm,
+  // which must be the one used for the rest of the run
+  SimulatedAnnealingCore(double (*uniform)());
+
+  ~SimulatedAnnealingCore() {}
+  SimulatedAnnealingCore(const SimulatedAnnealingCore&) = delete;
+  SimulatedAnnealingCore &operator = (const SimulatedAnnealingCore&) = delete;
+
+  // start a new schedule with the given start temperature and epsilon
+  void reset(const double Tstart, const double epsilon);
+
+  // decide whether ynew is accepted over ycur at the given step
+  // step = step index; must be >= 2 and should increase by one per call
+  bool accept(const double ycur, const double ynew,
+      const unsigned long long step);
+
+private:
+  // move the temperature and the band to the given step
+  void advance(const unsigned long long step);
+
+  double (*uniform_)();
+
+  double Tstart_;
+  double epsilon_;
+  double factor_; /// < 1 - epsilon
+
+  unsigned long long step_; /// < the step of T_
+  double T_; /// < the incrementally computed temperature
+
+  unsigned long long band_; /// < the band of step_ (starting at 1)
+  double Thigh_; /// < the temperature at the first step of the band
+  double Tlow_; /// < the temperature at the first step of the next band
+
+  vector<unsigned long long> table_band_; /// < band of the tabulated bounds
+  vector<double> table_low_; /// < lower bound of P per integer DeltaE
+  vector<double> table_high_; /// < upper bound of P per integer DeltaE
+};
+
+#endif
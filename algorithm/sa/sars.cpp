@@ -53,43 +53,13 @@
  * Email: tweise@hfuu.edu.cn, tweise@ustc.edu.cn
  */
 #include "sars.h"
+#include "sacore.h"
 #include <math.h>
-
-// Compute the acceptance probability from DeltaE and the temperature
-// DeltaE must be positive
-inline static double p_accept(const double DeltaE, const double temperature) {
-  return exp(-DeltaE / temperature);
-}
-
-// Compute the temperature at a given step
-// Tstart = start temperatre
-// epsilon = temperature decrease parameter
-// step = step index; must be >= 1
-inline static double temperature(const double Tstart, const double epsilon,
-    const unsigned long long step) {
-  return Tstart * pow(1.0 - epsilon, step - 1);
-}
-
-// compute a temperature from a given DeltaE and acceptance probability P
-inline static double T_from_DeltaE_and_P(const double DeltaE, const double P) {
-  if ((!isfinite(DeltaE)) || (DeltaE <= 0.0))
-    throw "DeltaE must be positive and finite.";
-  if ((!isfinite(P)) || (P <= 0.0) || (P >= 1.0))
-    throw "P must be finite and from (0,1).";
-  return -DeltaE / log(P);
-}
-
-inline static double epsilon_from_T_and_step(const double Tstart,
-    const double Tstep, const unsigned long long step) {
-  if ((!isfinite(Tstart)) || (Tstart <= 0.0))
-    throw "Tstart must be positive and finite.";
-  if ((!isfinite(Tstep)) || (Tstep >= Tstart))
-    throw "Tstep must finite and > Tstart";
-  const double epsilon = 1.0 - pow(Tstep / Tstart, 1.0 / (step - 1));
-  if ((!isfinite(epsilon)) || (epsilon <= 0.0) || (epsilon >= 1.0))
-    throw "epsilon must be positive and from (0,1)";
-  return epsilon;
-}
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 void simulated_annealing_exp_rs(shared_ptr<IOHprofiler_problem<int>> problem,
     shared_ptr<IOHprofiler_csv_logger<int>> logger,
@@ -142,6 +112,9 @@ void simulated_annealing_exp_rs(shared_ptr<IOHprofiler_problem<int>> problem,
   parameter_names.push_back("p");
   logger->set_parameters(parameters, parameter_names);
 
+// the core deciding about the acceptance of new solutions
+  SimulatedAnnealingCore core(uniform_random);
+
   unsigned long long int innerBudget = 512;
   unsigned long long int stepMain = 1;
 
@@ -158,6 +131,7 @@ void simulated_annealing_exp_rs(shared_ptr<IOHprofiler_problem<int>> problem,
     *epsilon = epsilon_from_T_and_step(Tstart, *Tend, innerBudget);
     if ((!isfinite(*epsilon)) || (*epsilon <= 0) || (*epsilon >= 1))
       throw "epsilon must be in (0,1)";
+    core.reset(Tstart, *epsilon);
 
     ycur = std::numeric_limits<double>::infinity();
     ynew = std::numeric_limits<double>::infinity();
@@ -195,9 +169,7 @@ void simulated_annealing_exp_rs(shared_ptr<IOHprofiler_problem<int>> problem,
 
 // if new solution is at least as good as current one, accept it
 // otherwise: if check if it is acceptable at the current temperature
-      if ((ynew >= ycur)
-          || (uniform_random()
-              < p_accept(ycur - ynew, temperature(Tstart, *epsilon, step)))) {
+      if (core.accept(ycur, ynew, step)) {
         ycur = ynew;
         xcur = xnew;
       }
@@ -234,3 +206,312 @@ void run_simulated_annealing_exp_rs(const string folder_path,
 
   logger->clear_logger();
 }
+
+// the number of evaluations a portfolio worker hands over at once
+#define SARS_PORTFOLIO_BATCH 64
+// the maximum number of evaluations a portfolio worker may be ahead of the logger
+#define SARS_PORTFOLIO_QUEUE 4096
+
+// each portfolio worker has its own random number generator
+static thread_local default_random_engine portfolio_random_gen;
+static thread_local uniform_real_distribution<double> portfolio_uniform_dis(0.0, 1.0);
+
+static double portfolio_uniform_random() {
+  return portfolio_uniform_dis(portfolio_random_gen);
+}
+
+// an evaluation performed by a portfolio worker, to be recorded by the main thread
+struct SarsEvaluation {
+  double raw;
+  double transformed;
+  double Tend;
+  double epsilon;
+  double innerBudget;
+};
+
+// the configuration of an inner run of the portfolio
+struct SarsInnerRun {
+  unsigned long long innerBudget; // 0 if the inner run is never reached
+  double Tend;
+  double epsilon;
+};
+
+// the evaluations handed over from a portfolio worker to the main thread
+struct SarsWorkerQueue {
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<std::vector<SarsEvaluation> > batches;
+  size_t queued = 0;
+};
+
+// the state shared by all portfolio workers of a run
+struct SarsPortfolioShared {
+// the last evaluation index which will be recorded: the budget, or the index of the
+// first evaluation which hits the optimum
+  std::atomic<unsigned long long> limit;
+// set by the main thread when the run is over
+  std::atomic<bool> stop;
+};
+
+// A portfolio worker performing the inner runs slot, slot + threads, slot + 2*threads, ...
+// The i-th evaluation (i >= 0) of the worker becomes evaluation number
+// (i * threads) + slot + 1 of the run, i.e., the evaluations of the workers are recorded
+// in round robin order. The evaluations of a worker only depend on its seeds, so the
+// recorded sequence does not depend on the scheduling of the threads.
+// The inner runs are configured by the main thread, which checks their parameters, so
+// the worker does not throw.
+static void simulated_annealing_exp_rs_worker(
+    shared_ptr<IOHprofiler_problem<int>> problem, const unsigned long long slot,
+    const unsigned long long threads, const unsigned long long seed,
+    const double Tstart, const std::vector<SarsInnerRun> *inner_runs,
+    SarsWorkerQueue *queue, SarsPortfolioShared *shared) {
+  const int n = problem->IOHprofiler_get_number_of_variables();
+  const double p = 1.0 / ((double) n);
+  const double optimum = problem->IOHprofiler_get_optimal()[0];
+
+  SimulatedAnnealingCore core(portfolio_uniform_random);
+  std::vector<int> xcur(n);
+  std::vector<int> xnew;
+  double ycur, ynew, raw;
+  SarsEvaluation evaluation;
+
+  std::vector<SarsEvaluation> batch;
+  batch.reserve(SARS_PORTFOLIO_BATCH);
+// the index of the next evaluation of this worker in the run
+  unsigned long long index = slot + 1;
+
+// hand over the collected evaluations, waiting while the main thread is too far behind
+  auto flush = [&]() {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    queue->condition.wait(lock, [&]() {
+      return (queue->queued < SARS_PORTFOLIO_QUEUE) || shared->stop.load();
+    });
+    queue->queued += batch.size();
+    queue->batches.push_back(std::move(batch));
+    batch = std::vector<SarsEvaluation>();
+    batch.reserve(SARS_PORTFOLIO_BATCH);
+    lock.unlock();
+    queue->condition.notify_all();
+  };
+
+// store an evaluation and return whether the worker should continue
+  auto emit = [&](const double transformed) -> bool {
+    evaluation.raw = raw;
+    evaluation.transformed = transformed;
+    batch.push_back(evaluation);
+    if (transformed == optimum) {
+// no evaluation after this one will ever be recorded
+      unsigned long long limit = shared->limit.load();
+      while ((index < limit) && !shared->limit.compare_exchange_weak(limit, index)) {}
+    }
+    index += threads;
+    const bool proceed = (index <= shared->limit.load()) && !shared->stop.load();
+    if ((!proceed) || (batch.size() >= SARS_PORTFOLIO_BATCH)) {
+      flush();
+    }
+    return proceed;
+  };
+
+  for (unsigned long long restart = slot; ; restart += threads) {
+// the worker stops within its last reachable inner run
+    if ((restart >= inner_runs->size()) || ((*inner_runs)[restart].innerBudget == 0)) return;
+    const SarsInnerRun &inner_run = (*inner_runs)[restart];
+    const unsigned long long innerBudget = inner_run.innerBudget;
+    core.reset(Tstart, inner_run.epsilon);
+    evaluation.Tend = inner_run.Tend;
+    evaluation.epsilon = inner_run.epsilon;
+    evaluation.innerBudget = (double) innerBudget;
+
+// each inner run has its own random seed
+    std::seed_seq seeds{(unsigned long) (seed & 0xffffffffULL),
+      (unsigned long) (seed >> 32), (unsigned long) restart};
+    portfolio_random_gen.seed(seeds);
+
+// first we generate the random initial solution
+    for (int i = 0; i < n; i++) {
+      xcur[i] = (int) (2 * portfolio_uniform_random());
+    }
+// we evaluate the random initial solution
+    ycur = problem->evaluate_detached(xcur, raw);
+    if (!emit(ycur)) return;
+
+// we perform iterations until the budget of the inner run has been exhausted
+    for (unsigned long long step = 2; step <= innerBudget; ++step) {
+// copy the current solution to the new solution
+      xnew = xcur;
+      bool unchanged = true;
+// until the solution changes, repeat
+      do {
+        // flip each bit with the independent probability of 1/n
+        for (int i = n; (--i) >= 0;) {
+          if (portfolio_uniform_random() < p) {
+            unchanged = false; // there was a change
+            xnew[i] ^= 1; // flip the bit
+          }
+        }
+      } while (unchanged); // repeat until at least one change
+
+// evaluate the new candidate solution
+      ynew = problem->evaluate_detached(xnew, raw);
+      if (!emit(ynew)) return;
+
+// if new solution is at least as good as current one, accept it
+// otherwise: if check if it is acceptable at the current temperature
+      if (core.accept(ycur, ynew, step)) {
+        ycur = ynew;
+        xcur = xnew;
+      }
+    }
+  }
+}
+
+void simulated_annealing_exp_rs_portfolio(
+    shared_ptr<IOHprofiler_problem<int>> problem,
+    shared_ptr<IOHprofiler_csv_logger<int>> logger,
+    const unsigned long long eval_budget, const unsigned int threads) {
+// check input variables
+  if (eval_budget <= 1) throw "eval_budget must be > 1";
+  if (!problem) throw "problem must not be null";
+  if (!logger) throw "logger must not be null";
+  if (threads < 1) throw "threads must be > 0";
+
+// n be the number of variables
+  const int n = problem->IOHprofiler_get_number_of_variables();
+  if (n <= 0) throw "number of variables must be positive";
+// the bit flip probability
+  const double p = 1.0 / ((double) n);
+  if ((!isfinite(p)) || (p <= 0.0) || (p >= 1.0)) throw "p must be from (0,1)";
+
+  const double Tstart = T_from_DeltaE_and_P(max(1.0, n / 4.0), 0.1);
+  if ((!isfinite(Tstart)) || (Tstart < 1)) throw "Tstart must be >= 1";
+
+  std::shared_ptr<double> Tend = std::make_shared<double>(0);
+  std::shared_ptr<double> epsilon = std::make_shared<double>(0);
+  std::shared_ptr<double> innerBudgetParam = std::make_shared<double>(0);
+
+  // store all the parameters
+  std::vector<std::shared_ptr<double> > parameters;
+  parameters.push_back(std::make_shared<double>(Tstart));
+  parameters.push_back(Tend);
+  parameters.push_back(epsilon);
+  parameters.push_back(innerBudgetParam);
+  parameters.push_back(std::make_shared<double>(p));
+  std::vector<std::string> parameter_names;
+  parameter_names.push_back("Tstart");
+  parameter_names.push_back("Tend");
+  parameter_names.push_back("epsilon");
+  parameter_names.push_back("innerBudget");
+  parameter_names.push_back("p");
+  logger->set_parameters(parameters, parameter_names);
+
+// configure the inner runs which can be reached within the budget, as in the sequential
+// version: the restart-th inner run is performed by worker restart % threads and starts
+// with the evaluation index of that worker after its previous inner runs
+  std::vector<SarsInnerRun> inner_runs;
+  for (unsigned long long slot = 0; slot < threads; ++slot) {
+    unsigned long long index = slot + 1;
+    for (unsigned long long restart = slot; index <= eval_budget; restart += threads) {
+      SarsInnerRun inner_run;
+      inner_run.innerBudget = 1024ULL << min(restart, 53ULL);
+      inner_run.Tend = T_from_DeltaE_and_P(1.0, 1.0 / sqrt(inner_run.innerBudget));
+      if ((!isfinite(inner_run.Tend)) || (inner_run.Tend >= Tstart)) throw "Tend must be < Tstart";
+      inner_run.epsilon = epsilon_from_T_and_step(Tstart, inner_run.Tend, inner_run.innerBudget);
+      if ((!isfinite(inner_run.epsilon)) || (inner_run.epsilon <= 0) || (inner_run.epsilon >= 1))
+        throw "epsilon must be in (0,1)";
+      if (inner_runs.size() <= restart) {
+        SarsInnerRun unreached;
+        unreached.innerBudget = 0;
+        inner_runs.resize(restart + 1, unreached);
+      }
+      inner_runs[restart] = inner_run;
+      if (inner_run.innerBudget > (eval_budget - index) / threads) break;
+      index += inner_run.innerBudget * threads;
+    }
+  }
+
+// the seed of the workers of this run
+  const unsigned long long seed = (((unsigned long long) random_gen()) << 32)
+      ^ ((unsigned long long) random_gen());
+
+  SarsPortfolioShared shared;
+  shared.limit = eval_budget;
+  shared.stop = false;
+  std::vector<SarsWorkerQueue> queues(threads);
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  for (unsigned int i = 0; i < threads; ++i) {
+    workers.push_back(std::thread(simulated_annealing_exp_rs_worker, problem,
+        (unsigned long long) i, (unsigned long long) threads, seed, Tstart,
+        &inner_runs, &queues[i], &shared));
+  }
+
+// record and log the evaluations of the workers in round robin order
+  std::vector<std::vector<SarsEvaluation> > batches(threads);
+  std::vector<size_t> positions(threads, 0);
+  for (unsigned long long step = 1;
+      (step <= eval_budget) && (!problem->IOHprofiler_hit_optimal()); ++step) {
+    const unsigned int slot = (unsigned int) ((step - 1) % threads);
+    if (positions[slot] >= batches[slot].size()) {
+      SarsWorkerQueue &queue = queues[slot];
+      std::unique_lock<std::mutex> lock(queue.mutex);
+      queue.condition.wait(lock, [&]() { return !queue.batches.empty(); });
+      batches[slot] = std::move(queue.batches.front());
+      queue.batches.pop_front();
+      queue.queued -= batches[slot].size();
+      lock.unlock();
+      queue.condition.notify_all();
+      positions[slot] = 0;
+    }
+    const SarsEvaluation &evaluation = batches[slot][positions[slot]++];
+    *Tend = evaluation.Tend;
+    *epsilon = evaluation.epsilon;
+    *innerBudgetParam = evaluation.innerBudget;
+    problem->record_evaluation(evaluation.raw, evaluation.transformed);
+    logger->do_log(problem->loggerInfo());
+  }
+
+// terminate all workers
+  shared.stop = true;
+  for (unsigned int i = 0; i < threads; ++i) {
+    {
+      std::lock_guard<std::mutex> lock(queues[i].mutex);
+    }
+    queues[i].condition.notify_all();
+  }
+  for (unsigned int i = 0; i < threads; ++i) {
+    workers[i].join();
+  }
+}
+
+// run the simulated annealing algorithm with automatic configuration and a portfolio
+// of concurrent restarts
+void run_simulated_annealing_exp_rs_portfolio(const string folder_path,
+    shared_ptr<IOHprofiler_suite<int>> suite,
+    const unsigned long long eval_budget,
+    const unsigned long long independent_runs,
+    const unsigned long long rand_seed,
+    const unsigned int threads) {
+  if (folder_path.empty()) throw "folder path cannot be empty";
+  if (!suite) throw "suite cannot be null";
+  if (eval_budget <= 1) throw "eval_budget must be > 1";
+  if (independent_runs < 1) throw "independent_runs must be > 0";
+  if (threads < 1) throw "threads must be > 0";
+
+  const string algorithm_name = "sars_portfolio_auto";
+  std::shared_ptr<IOHprofiler_csv_logger<int>> logger(
+      new IOHprofiler_csv_logger<int>(folder_path, algorithm_name,
+          algorithm_name, algorithm_name));
+  logger->activate_logger();
+
+  random_gen.seed(rand_seed);
+  shared_ptr<IOHprofiler_problem<int> > problem;
+  while ((problem = suite->get_next_problem()) != nullptr) {
+    for (unsigned long long i = 0; i < independent_runs; i++) {
+      problem->reset_problem();
+      logger->track_problem(*problem);
+      simulated_annealing_exp_rs_portfolio(problem, logger, eval_budget, threads);
+    }
+  }
+
+  logger->clear_logger();
+}
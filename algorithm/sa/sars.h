@@ -46,6 +46,16 @@
  * - Problems whose objective value range differs largely
  *   from n (e.g., LARS) will probably not be solved well.
  *
+ * The restarts are independent of each other apart from the
+ * shared budget. In the portfolio mode, several of them run
+ * concurrently in threads: the k-th of t threads performs the
+ * inner runs k, k+t, k+2t, ..., each with its own random seed
+ * drawn from the seed of the run. The evaluations of the threads
+ * are recorded and logged in round robin order, so the log is a
+ * valid single run which only depends on the seed and t. All
+ * threads stop once the optimum is recorded or the budget is
+ * exhausted.
+ *
  * Author: Thomas Weise
  *         Institute of Applied Optimization
  *         Hefei University
@@ -56,10 +66,29 @@
 #define _SARS_H_
 #include "common.h"
 
+// perform a single run of the simulated annealing algorithm with restarts on the
+// problem, which must have been reset and be tracked by the logger
+void simulated_annealing_exp_rs(shared_ptr<IOHprofiler_problem<int>> problem,
+    shared_ptr<IOHprofiler_csv_logger<int>> logger,
+    const unsigned long long eval_budget);
+
+// perform a single run of the portfolio mode on 'threads' threads
+void simulated_annealing_exp_rs_portfolio(
+    shared_ptr<IOHprofiler_problem<int>> problem,
+    shared_ptr<IOHprofiler_csv_logger<int>> logger,
+    const unsigned long long eval_budget, const unsigned int threads);
+
 void run_simulated_annealing_exp_rs(const string folder_path,
     shared_ptr<IOHprofiler_suite<int>> suite,
     const unsigned long long eval_budget,
     const unsigned long long independent_runs,
     const unsigned long long rand_seed);
 
+void run_simulated_annealing_exp_rs_portfolio(const string folder_path,
+    shared_ptr<IOHprofiler_suite<int>> suite,
+    const unsigned long long eval_budget,
+    const unsigned long long independent_runs,
+    const unsigned long long rand_seed,
+    const unsigned int threads);
+
 #endif
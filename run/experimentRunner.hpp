@@ -0,0 +1,262 @@
+//
+//  experimentRunner.hpp
+//  ConfigurableGA
+//
+/// \brief Runs several algorithms on the problems of a suite within one process.
+///
+/// The problem instances of the suite are shared by all algorithms. If the suite is lazy, see
+/// IOHprofiler_set_lazy_load_flag, an instance is created by the suite for its first run and
+/// released after its last run over all algorithms, so only the instances in use are kept
+/// in memory.
+/// The runs of an algorithm on the instances and dimensions of one problem form a chain,
+/// which is performed in the order of the suite and logged into the same folder and files as
+/// the run() functions of the algorithms would do. The chains are scheduled on a pool of
+/// threads, and a problem instance is used by one run at a time only. Since the runs of a chain
+/// are performed in order, at most (number of algorithms) * (number of problem ids) threads
+/// are used.
+///
+/// Each run seeds the random generators of its thread from the seed, the problem id, the
+/// instance, the dimension, and the index of the run. The results thus do not depend on the
+/// number of threads or the schedule, and all algorithms start from the same random numbers
+/// on the same run.
+
+#ifndef _EXPERIMENT_RUNNER_HPP_
+#define _EXPERIMENT_RUNNER_HPP_
+
+#include "../algorithm/ga/src/common.h"
+
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+/// A single run of an algorithm on a problem, including resetting the problem and
+/// tracking it with the logger.
+typedef function<void (shared_ptr<IOHprofiler_problem<int> >, shared_ptr<IOHprofiler_csv_logger<int> >)> algorithm_run;
+
+/// An algorithm to be run by the ExperimentRunner.
+struct ExperimentAlgorithm {
+  string folder_name; /// < the name of the output folder, renamed if it exists already.
+  string algorithm_name; /// < the algorithm name written to the logs.
+  function<algorithm_run ()> create; /// < creates a new instance of the algorithm for each chain.
+};
+
+class ExperimentRunner {
+public:
+  ExperimentRunner(shared_ptr<IOHprofiler_suite<int> > suite, const string dir, const int runs, const unsigned seed, const unsigned threads) :
+    suite_(suite),
+    dir_(dir),
+    runs_(runs),
+    seed_(seed),
+    threads_(threads) {
+    if (!suite) throw "suite cannot be null";
+    if (runs < 1) throw "runs must be > 0";
+    if (threads < 1) throw "threads must be > 0";
+    if (!suite->IOHprofiler_get_load_problem_flag()) {
+      suite->loadProblem();
+    }
+    /// the problems are ordered by problem, then by dimension, then by instance, see create_problem()
+    const vector<int> problem_id = suite->IOHprofiler_suite_get_problem_id();
+    const vector<int> instance_id = suite->IOHprofiler_suite_get_instance_id();
+    const vector<int> dimension = suite->IOHprofiler_suite_get_dimension();
+    this->problems_.resize(suite->IOHprofiler_get_size_of_problem_list());
+    for (size_t index = 0; index != this->problems_.size(); ++index) {
+      this->problems_[index].problem_id = problem_id[index / instance_id.size() / dimension.size()];
+    }
+  }
+
+  ~ExperimentRunner() {}
+  ExperimentRunner(const ExperimentRunner&) = delete;
+  ExperimentRunner &operator = (const ExperimentRunner&) = delete;
+
+  void add_algorithm(const ExperimentAlgorithm &algorithm) {
+    this->algorithms_.push_back(algorithm);
+  }
+
+  /// \fn run()
+  /// \brief Performs all runs of all algorithms on all problems of the suite.
+  ///
+  /// If a run throws, no further runs are started, and the exception is thrown again once the
+  /// runs in progress are done.
+  void run() {
+    this->chains_.clear();
+    this->failure_ = nullptr;
+    this->busy_ = vector<bool>(this->problems_.size(), false);
+    for (size_t i = 0; i != this->problems_.size(); ++i) {
+      this->problems_[i].remaining = this->algorithms_.size() * this->runs_;
+    }
+
+    /// the problems of each problem id, in the order of the suite
+    vector<vector<size_t> > problems_of_id;
+    vector<int> problem_ids;
+    for (size_t i = 0; i != this->problems_.size(); ++i) {
+      const int problem_id = this->problems_[i].problem_id;
+      size_t j = find(problem_ids.begin(), problem_ids.end(), problem_id) - problem_ids.begin();
+      if (j == problem_ids.size()) {
+        problem_ids.push_back(problem_id);
+        problems_of_id.push_back(vector<size_t>());
+      }
+      problems_of_id[j].push_back(i);
+    }
+
+    for (size_t a = 0; a != this->algorithms_.size(); ++a) {
+      const ExperimentAlgorithm &algorithm = this->algorithms_[a];
+      IOHprofiler_csv_logger<int> folder(this->dir_, algorithm.folder_name, algorithm.algorithm_name, algorithm.algorithm_name);
+      folder.activate_logger();
+      for (size_t j = 0; j != problems_of_id.size(); ++j) {
+        Chain chain;
+        chain.problems = problems_of_id[j];
+        chain.next = 0;
+        chain.running = false;
+        chain.run = algorithm.create();
+        chain.logger = shared_ptr<IOHprofiler_csv_logger<int> >(
+          new IOHprofiler_csv_logger<int>(this->dir_, folder.get_folder_name(), algorithm.algorithm_name, algorithm.algorithm_name));
+        this->chains_.push_back(chain);
+      }
+    }
+
+    const unsigned threads = static_cast<unsigned> (min(static_cast<size_t> (this->threads_), max(static_cast<size_t> (1), this->chains_.size())));
+    vector<thread> workers;
+    workers.reserve(threads);
+    for (unsigned i = 0; i != threads; ++i) {
+      workers.push_back(thread(&ExperimentRunner::Work, this));
+    }
+    for (unsigned i = 0; i != threads; ++i) {
+      workers[i].join();
+    }
+    if (this->failure_) {
+      rethrow_exception(this->failure_);
+    }
+  }
+
+private:
+  /// A problem instance of the suite, at the same index.
+  struct Problem {
+    int problem_id;
+    shared_ptr<IOHprofiler_problem<int> > problem; /// < null until its first run, and after its last one in the lazy mode.
+    size_t remaining; /// < the number of runs left on the problem, over all algorithms.
+  };
+
+  /// The runs of an algorithm on one problem id: the k-th run is run k % runs_
+  /// on problems_[problems[k / runs_]].
+  struct Chain {
+    vector<size_t> problems;
+    size_t next; /// < the next run to perform.
+    bool running;
+    algorithm_run run;
+    shared_ptr<IOHprofiler_csv_logger<int> > logger;
+  };
+
+  /// \fn Seed()
+  /// \brief The seed of a run, which only depends on the problem instance and the index of the run.
+  unsigned Seed(const IOHprofiler_problem<int> &problem, const int run) const {
+    seed_seq seq = {static_cast<int> (this->seed_), problem.IOHprofiler_get_problem_id(), problem.IOHprofiler_get_instance_id(),
+                    problem.IOHprofiler_get_number_of_variables(), run};
+    vector<unsigned> seed(1);
+    seq.generate(seed.begin(), seed.end());
+    return seed[0];
+  }
+
+  /// \fn Work()
+  /// \brief A worker thread, performing the next run of a chain whose problem is not in use until all chains are done.
+  ///
+  /// The chain whose next problem comes first in the suite is preferred, so that the algorithms
+  /// that lag behind finish a problem before the others create further ones.
+  void Work() {
+    unique_lock<mutex> lock(this->mutex_);
+    while (true) {
+      if (this->failure_) {
+        return;
+      }
+      bool pending = false;
+      size_t c = this->chains_.size();
+      for (size_t i = 0; i != this->chains_.size(); ++i) {
+        const Chain &chain = this->chains_[i];
+        if (chain.next == chain.problems.size() * this->runs_) {
+          continue;
+        }
+        pending = true;
+        const size_t p = chain.problems[chain.next / this->runs_];
+        if (!chain.running && !this->busy_[p] && (c == this->chains_.size() || p < this->chains_[c].problems[this->chains_[c].next / this->runs_])) {
+          c = i;
+        }
+      }
+      if (!pending) {
+        return;
+      }
+      if (c == this->chains_.size()) {
+        this->condition_.wait(lock);
+        continue;
+      }
+
+      Chain &chain = this->chains_[c];
+      const size_t p = chain.problems[chain.next / this->runs_];
+      const int run = static_cast<int> (chain.next % this->runs_);
+      chain.running = true;
+      this->busy_[p] = true;
+      lock.unlock();
+
+      try {
+        const shared_ptr<IOHprofiler_problem<int> > problem = this->Acquire(p);
+        seed_random_generators(this->Seed(*problem, run));
+        chain.run(problem, chain.logger);
+        if (chain.next + 1 == chain.problems.size() * this->runs_) {
+          chain.logger->clear_logger();
+          chain.run = algorithm_run();
+        }
+      } catch (...) {
+        lock.lock();
+        if (!this->failure_) {
+          this->failure_ = current_exception();
+        }
+        this->condition_.notify_all();
+        return;
+      }
+
+      lock.lock();
+      ++chain.next;
+      chain.running = false;
+      this->busy_[p] = false;
+      if (--this->problems_[p].remaining == 0) {
+        this->problems_[p].problem = nullptr;
+      }
+      this->condition_.notify_all();
+    }
+  }
+
+  /// \fn Acquire()
+  /// \brief The instance of problems_[p], which is taken from the suite for its first run.
+  ///
+  /// The caller has marked the problem busy, so no other thread uses problems_[p].
+  shared_ptr<IOHprofiler_problem<int> > Acquire(const size_t p) {
+    Problem &problem = this->problems_[p];
+    if (problem.problem == nullptr) {
+      lock_guard<mutex> lock(this->suite_mutex_);
+      if (this->suite_->IOHprofiler_get_lazy_load_flag()) {
+        problem.problem = this->suite_->create_problem(p);
+      } else {
+        problem.problem = (*this->suite_)[p];
+      }
+    }
+    return problem.problem;
+  }
+
+  shared_ptr<IOHprofiler_suite<int> > suite_;
+  string dir_;
+  size_t runs_;
+  unsigned seed_;
+  unsigned threads_;
+
+  vector<Problem> problems_;
+  vector<ExperimentAlgorithm> algorithms_;
+  vector<Chain> chains_;
+  vector<bool> busy_; /// < whether problems_[i] is used by a run.
+  exception_ptr failure_; /// < the exception of the first run which failed.
+
+  mutex mutex_;
+  mutex suite_mutex_; /// < serializes the creation of problems by the suite.
+  condition_variable condition_;
+};
+
+#endif // _EXPERIMENT_RUNNER_HPP_
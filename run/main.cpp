@@ -12,12 +12,14 @@
 #include "../algorithm/ga/instance/oneLLEA.h"
 #include "../algorithm/ga/instance/twoRateEA.h"
 #include "../algorithm/fea/opoea.h"
+#include "../algorithm/fea/opoealockstep.h"
 #include "../algorithm/fea/opofea.h"
 #include "../algorithm/sa/sa.h"
 #include "../algorithm/sa/sars.h"
 #include "../algorithm/ghc/ghc.h"
 #include "../algorithm/eda/estimationOfDistribution.h"
 #include "../algorithm/rs/randomsearch.h"
+#include "experimentRunner.hpp"
 
 #include "IOHprofiler_string.hpp"
 #include "wmodelsuite/w_model_OneMax_suite.hpp"
@@ -25,6 +27,8 @@
 #include "IOHprofiler_PBO_suite.hpp"
 
 #include <vector>
+#include <thread>
+#include <sstream>
 
 using namespace std;
 
@@ -33,18 +37,23 @@ using namespace std;
  *    ea : (1+1)-EA>0 p = 1/n
  *    ea2 : (1+1)-EA>0 p = 2/n
  *    ea23 : (1+1)-EA>0 p = 2/3n
+ *    ealockstep : (1+1)-EA>0 p = 1/n performing 16 independent runs in lockstep
  *    llea  : (1+(lambda,lambda))-EA>_0, initial lambda = 10, p = 1/n
  *    rls : randomized local search
  *    rs : random search
+ *    brs : random search sampling and evaluating in bulk on 'threads' threads
  *    ghc : greedy hill climber
+ *    ghcrandom : greedy hill climber going through the bits in a random order
+ *    ghcbest : greedy hill climber accepting the best neighbour (best improvement)
  *    fga : (1+1)-fast GA
  *    2ratega : (1+10)-EA>0 with 2rate self adaptation of mutation rate
  *    umda : univarate marginal distribution algorithm, population size = 50
  *    sa : simulated annealing
  *    sars : the simulated annealing algorithm with exponential temperature schedule with iterative restarts
+ *    psars : sars with the inner restarts running concurrently on 'threads' threads
  *    fea : (1+1)-EA>0 with frequency fitness assignment
  */
-void runAlgorithm(shared_ptr< IOHprofiler_suite<int> > suite, const string algorithm_name, const string dir, const int budget, const int runs, const unsigned seed)
+void runAlgorithm(shared_ptr< IOHprofiler_suite<int> > suite, const string algorithm_name, const string dir, const int budget, const int runs, const unsigned seed, const unsigned threads)
 {
   if (algorithm_name == "ea") {
     staticEA ea(1, 1, 1.0);
@@ -55,6 +64,8 @@ void runAlgorithm(shared_ptr< IOHprofiler_suite<int> > suite, const string algor
   } else if (algorithm_name == "ea23") {
     staticEA ea(1, 1, 1.5);
     ea.run(dir, algorithm_name, suite, budget, std::numeric_limits<int>::max(), runs, seed);
+  } else if (algorithm_name == "ealockstep") {
+    run_ea1p1_lockstep(dir, suite, budget, runs, seed, EA1P1_LOCKSTEP_LANES);
   } else if (algorithm_name == "llea") {
     oneLambdaLambdaEA llEA(1);
     llEA.run(dir, algorithm_name, suite, budget, std::numeric_limits<int>::max(), runs, seed);
@@ -64,9 +75,18 @@ void runAlgorithm(shared_ptr< IOHprofiler_suite<int> > suite, const string algor
   } else if (algorithm_name == "rs") {
     RandomSearch rs;
     rs.run(dir, algorithm_name, suite, budget,runs, seed);
+  } else if (algorithm_name == "brs") {
+    RandomSearch rs(true, threads);
+    rs.run(dir, algorithm_name, suite, budget,runs, seed);
   } else if (algorithm_name == "ghc") {
     GreedyHillClimber ghc;
     ghc.run(dir, algorithm_name, suite, budget, runs, seed);
+  } else if (algorithm_name == "ghcrandom") {
+    GreedyHillClimber ghc(RANDOMORDER);
+    ghc.run(dir, algorithm_name, suite, budget, runs, seed);
+  } else if (algorithm_name == "ghcbest") {
+    GreedyHillClimber ghc(BESTIMPROVEMENT);
+    ghc.run(dir, algorithm_name, suite, budget, runs, seed);
   } else if (algorithm_name == "fga") {
     FastGA fGA(1, 1);
     fGA.run(dir, algorithm_name, suite, budget, std::numeric_limits<int>::max(), runs, seed);
@@ -80,6 +100,8 @@ void runAlgorithm(shared_ptr< IOHprofiler_suite<int> > suite, const string algor
     run_simulated_annealing_exp(dir, suite, budget, runs, seed);
   } else if (algorithm_name == "sars") {
     run_simulated_annealing_exp_rs(dir, suite, budget, runs, seed);
+  } else if (algorithm_name == "psars") {
+    run_simulated_annealing_exp_rs_portfolio(dir, suite, budget, runs, seed, threads);
   } else if (algorithm_name == "fea") {
     run_fea1p1(dir, suite, budget, runs, seed);
   } else {
@@ -87,9 +109,170 @@ void runAlgorithm(shared_ptr< IOHprofiler_suite<int> > suite, const string algor
   }
 }
 
+/// A run of a genetic algorithm instance with the given budget.
+static algorithm_run geneticAlgorithmRun(shared_ptr<GeneticAlgorithm> ga, const int budget)
+{
+  ga->set_evaluation_budget(budget);
+  ga->set_generation_budget(std::numeric_limits<int>::max());
+  return [ga](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+    ga->AssignProblem(problem);
+    ga->AssignLogger(logger);
+    ga->DoGeneticAlgorithm();
+  };
+}
+
+/// A run of one of the algorithms implemented as functions with the given budget.
+static algorithm_run functionRun(void (*algorithm)(shared_ptr<IOHprofiler_problem<int> >, shared_ptr<IOHprofiler_csv_logger<int> >, const unsigned long long), const int budget)
+{
+  return [algorithm, budget](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+    problem->reset_problem();
+    logger->track_problem(*problem);
+    algorithm(problem, logger, budget);
+  };
+}
+
+/**
+ * Describes the algorithm 'algorithm_name' (see runAlgorithm) for the ExperimentRunner, with the same
+ * folder and algorithm names as runAlgorithm uses. Returns false for unknown algorithms.
+ * brs and psars use a single thread per run, since the runner already keeps all threads busy.
+ * ealockstep performs the runs one at a time, since the runner schedules each run separately.
+ */
+bool experimentAlgorithm(const string algorithm_name, const int budget, ExperimentAlgorithm &algorithm)
+{
+  algorithm.folder_name = algorithm_name;
+  if (algorithm_name == "ea" || algorithm_name == "ea2" || algorithm_name == "ea23") {
+    const double mutation_rate_scale = algorithm_name == "ea" ? 1.0 : (algorithm_name == "ea2" ? 2.0 : 1.5);
+    algorithm.algorithm_name = "(1+1)>_0 EA";
+    algorithm.create = [mutation_rate_scale, budget]() -> algorithm_run {
+      shared_ptr<staticEA> ea(new staticEA(1, 1, mutation_rate_scale));
+      ea->set_evaluation_budget(budget);
+      ea->set_generation_budget(std::numeric_limits<int>::max());
+      return [ea](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+        ea->AssignProblem(problem);
+        ea->AssignLogger(logger);
+        ea->set_mutation_rate(ea->mutation_rate_scale_ / static_cast<double> (ea->get_dimension()));
+        ea->DoGeneticAlgorithm();
+      };
+    };
+  } else if (algorithm_name == "ealockstep") {
+    algorithm.folder_name = algorithm.algorithm_name = "opoea_lockstep";
+    algorithm.create = [budget]() -> algorithm_run {
+      return [budget](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+        ea1p1_lockstep(problem, logger, budget, 1);
+      };
+    };
+  } else if (algorithm_name == "llea") {
+    algorithm.algorithm_name = "(1+(1,1))>_0 EA";
+    algorithm.create = [budget]() { return geneticAlgorithmRun(shared_ptr<GeneticAlgorithm>(new oneLambdaLambdaEA(1)), budget); };
+  } else if (algorithm_name == "rls") {
+    algorithm.algorithm_name = "RLS";
+    algorithm.create = [budget]() { return geneticAlgorithmRun(shared_ptr<GeneticAlgorithm>(new RLS()), budget); };
+  } else if (algorithm_name == "fga") {
+    algorithm.algorithm_name = "(1+1) fast GA";
+    algorithm.create = [budget]() { return geneticAlgorithmRun(shared_ptr<GeneticAlgorithm>(new FastGA(1, 1)), budget); };
+  } else if (algorithm_name == "2ratega") {
+    algorithm.algorithm_name = "(1+10)-2rate-EA>0";
+    algorithm.create = [budget]() { return geneticAlgorithmRun(shared_ptr<GeneticAlgorithm>(new TwoRateEA(10)), budget); };
+  } else if (algorithm_name == "rs" || algorithm_name == "brs") {
+    const bool bulk = algorithm_name == "brs";
+    algorithm.algorithm_name = bulk ? "random search bulk" : "random search";
+    algorithm.create = [bulk, budget]() -> algorithm_run {
+      shared_ptr<RandomSearch> rs(new RandomSearch(bulk, 1));
+      rs->set_evaluation_budget(budget);
+      return [rs](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+        rs->AssignProblem(problem);
+        rs->AssignLogger(logger);
+        if (rs->get_bulk_sampling()) {
+          rs->DoBulkRandomSearch();
+        } else {
+          rs->DoRandomSearch();
+        }
+      };
+    };
+  } else if (algorithm_name == "ghc" || algorithm_name == "ghcrandom" || algorithm_name == "ghcbest") {
+    const neighbourhood_scan scan = algorithm_name == "ghc" ? FIRSTIMPROVEMENT : (algorithm_name == "ghcrandom" ? RANDOMORDER : BESTIMPROVEMENT);
+    algorithm.algorithm_name = algorithm_name == "ghc" ? "gHC" : (algorithm_name == "ghcrandom" ? "gHC_random" : "gHC_best");
+    algorithm.create = [scan, budget]() -> algorithm_run {
+      shared_ptr<GreedyHillClimber> ghc(new GreedyHillClimber(scan));
+      ghc->set_evaluation_budget(budget);
+      return [ghc](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+        ghc->AssignProblem(problem);
+        ghc->AssignLogger(logger);
+        ghc->DoGreedyHillClimber();
+      };
+    };
+  } else if (algorithm_name == "umda") {
+    algorithm.algorithm_name = "UMDA";
+    algorithm.create = [budget]() -> algorithm_run {
+      shared_ptr<EstimationOfDistribution> umda(new EstimationOfDistribution(25, 50));
+      umda->set_evaluation_budget(budget);
+      umda->set_generation_budget(std::numeric_limits<int>::max());
+      return [umda](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+        umda->AssignProblem(problem);
+        umda->AssignLogger(logger);
+        umda->DoEstimationOfDistribution();
+      };
+    };
+  } else if (algorithm_name == "sa") {
+    algorithm.folder_name = algorithm.algorithm_name = "sa_auto";
+    algorithm.create = [budget]() { return functionRun(simulated_annealing_exp, budget); };
+  } else if (algorithm_name == "sars") {
+    algorithm.folder_name = algorithm.algorithm_name = "sars_auto";
+    algorithm.create = [budget]() { return functionRun(simulated_annealing_exp_rs, budget); };
+  } else if (algorithm_name == "psars") {
+    algorithm.folder_name = algorithm.algorithm_name = "sars_portfolio_auto";
+    algorithm.create = [budget]() -> algorithm_run {
+      return [budget](shared_ptr<IOHprofiler_problem<int> > problem, shared_ptr<IOHprofiler_csv_logger<int> > logger) {
+        problem->reset_problem();
+        logger->track_problem(*problem);
+        simulated_annealing_exp_rs_portfolio(problem, logger, budget, 1);
+      };
+    };
+  } else if (algorithm_name == "fea") {
+    algorithm.folder_name = algorithm.algorithm_name = "opofea";
+    algorithm.create = [budget]() { return functionRun(fea1p1, budget); };
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Runs the comma separated algorithms 'algorithm_names' on the suite within this process,
+ * sharing the problem instances of the suite and running on 'threads' threads.
+ */
+void runAlgorithms(shared_ptr< IOHprofiler_suite<int> > suite, const string algorithm_names, const string dir, const int budget, const int runs, const unsigned seed, const unsigned threads)
+{
+  ExperimentRunner runner(suite, dir, runs, seed, threads);
+  stringstream names(algorithm_names);
+  string algorithm_name;
+  while (getline(names, algorithm_name, ',')) {
+    ExperimentAlgorithm algorithm;
+    if (experimentAlgorithm(algorithm_name, budget, algorithm)) {
+      runner.add_algorithm(algorithm);
+    } else {
+      cout << "Unkownn algorithm : " << algorithm_name << endl;
+    }
+  }
+  runner.run();
+}
+
+/// Runs a single algorithm with runAlgorithm, or several ones with runAlgorithms.
+void runSuite(shared_ptr< IOHprofiler_suite<int> > suite, const string algorithm_name, const string dir, const int budget, const int runs, const unsigned seed, const unsigned threads)
+{
+  if (algorithm_name.find(',') == string::npos) {
+    runAlgorithm(suite, algorithm_name, dir, budget, runs, seed, threads);
+  } else {
+    runAlgorithms(suite, algorithm_name, dir, budget, runs, seed, threads);
+  }
+}
+
 /**
  * Arguments: suite_name problem_id instance_id dimension
- *  algorithm_name : 'name'
+ *  algorithm_name : 'name' or 'name1,name2,...', several algorithms are run within this process on the
+ *                   same problem instances, with the runs distributed on 'threads' threads. The runs of an
+ *                   algorithm on one problem id are performed in order, so at most (number of algorithms) *
+ *                   (number of problem ids) threads are used
  *  suite_name : 'name', name \in {'PBO','WmodelOneMax', 'WmodelLeadingOnes'}
  *  problem_id : 'start-end' , id \in [1..25] for PBO, [1..product.size()] for Wmodel extensions.
  *  instance_id: 'start-end' , id \in [1..100]
@@ -98,8 +281,10 @@ void runAlgorithm(shared_ptr< IOHprofiler_suite<int> > suite, const string algor
  *  runs : 'number_of_indepedent_runs', runs > 1
  *  budget : 'budget', the maximum function evaluations. budget > 1
  *  seed : 'seed', a random seed
+ *  threads : 'threads', optional, the number of threads of parallel algorithms or of several algorithms, by default the number of hardware threads
  * 
  * An instance: ./main ea pbo 1-3 1-5 10,100 ./ 10 100 1
+ * Several algorithms: ./main ea,rls,sa pbo 1-3 1-5 10,100 ./ 10 100 1 4
  **/
 
 int main(int argc, const char *argv[])
@@ -119,6 +304,7 @@ int main(int argc, const char *argv[])
   int runs = stoi(argv[7]);
   int budget = stoi(argv[8]);
   unsigned seed =  static_cast<unsigned> (stoi(argv[9]));
+  unsigned threads = argc > 10 ? static_cast<unsigned> (stoi(argv[10])) : max(1u, thread::hardware_concurrency());
   
   transform(suite_name.begin(),suite_name.end(),suite_name.begin(),::tolower);
   transform(algorithm_name.begin(),algorithm_name.end(),algorithm_name.begin(),::tolower);
@@ -126,22 +312,22 @@ int main(int argc, const char *argv[])
     vector<int> problem_id = get_int_vector_parse_string(problem_str,1,25);
     vector<int> instance_id = get_int_vector_parse_string(instance_str,1,100);
     vector<int> dimension = get_int_vector_parse_string(dimension_str,2,20000);
-    shared_ptr<PBO_suite> suite(new PBO_suite(problem_id, instance_id, dimension));
-    runAlgorithm(suite, algorithm_name, dir, budget, runs, seed);
+    shared_ptr<PBO_suite> suite(new PBO_suite(problem_id, instance_id, dimension, true));
+    runSuite(suite, algorithm_name, dir, budget, runs, seed, threads);
   } else if (suite_name == "wmodelonemax") {
     vector<int> problem_id = get_int_vector_parse_string(problem_str,1,number_of_w_problems);
     vector<int> instance_id = get_int_vector_parse_string(instance_str,1,100);
     vector<int> dimension = get_int_vector_parse_string(dimension_str,2,20000);
     shared_ptr<W_Model_OneMax_suite> suite(
-      new W_Model_OneMax_suite(problem_id, instance_id, dimension, dummy, epistasis, neutrality, ruggedness));
-    runAlgorithm(suite, algorithm_name, dir, budget, runs, seed);
+      new W_Model_OneMax_suite(problem_id, instance_id, dimension, dummy, epistasis, neutrality, ruggedness, true));
+    runSuite(suite, algorithm_name, dir, budget, runs, seed, threads);
   } else if (suite_name == "wmodelleadingones") {
     vector<int> problem_id = get_int_vector_parse_string(problem_str,1,number_of_w_problems);
     vector<int> instance_id = get_int_vector_parse_string(instance_str,1,100);
     vector<int> dimension = get_int_vector_parse_string(dimension_str,2,20000);
     shared_ptr<W_Model_LeadingOnes_suite> suite(
-      new W_Model_LeadingOnes_suite(problem_id, instance_id, dimension, dummy, epistasis, neutrality, ruggedness));
-    runAlgorithm(suite, algorithm_name, dir, budget, runs, seed);
+      new W_Model_LeadingOnes_suite(problem_id, instance_id, dimension, dummy, epistasis, neutrality, ruggedness, true));
+    runSuite(suite, algorithm_name, dir, budget, runs, seed, threads);
   } else {
     cout << "Unknown suite : " << suite_name << ", avaliable options are \"PBO\", \"WModelOneMax\", and \"WModelLeadingOnes\"." << endl;
   }
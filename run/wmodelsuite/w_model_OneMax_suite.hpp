@@ -68,7 +68,8 @@ public:
                        vector<double> dummy_para = default_om_dummy,
                        vector<int> epistasis_para = default_om_epistasis,
                        vector<int> neturality_para = default_om_neutrality,
-                       vector<double> ruggedness_para = default_om_ruggedness)
+                       vector<double> ruggedness_para = default_om_ruggedness,
+                       const bool lazy_load = false)
       : dummy_para_(dummy_para),
         epistasis_para_(epistasis_para),
         neturality_para_(neturality_para),
@@ -117,59 +118,43 @@ public:
     IOHprofiler_set_suite_instance_id(instance_id);
     IOHprofiler_set_suite_dimension(dimension);
     IOHprofiler_set_suite_name("W_Model_OneMax_suite");
+    IOHprofiler_set_lazy_load_flag(lazy_load);
     this->loadProblem();
   }
 
+  /// \fn void loadProblem()
+  /// \brief Maps the ids of the problems to their names before loading them.
   void loadProblem()
   {
-
-    if (this->size() != 0)
-    {
-      this->clear();
-    }
-    this->IOHprofiler_set_size_of_problem_list(this->IOHprofiler_suite_get_number_of_problems() *
-                                               this->IOHprofiler_suite_get_number_of_instances() *
-                                               this->IOHprofiler_suite_get_number_of_dimensions());
-
     vector<int> p_id = this->IOHprofiler_suite_get_problem_id();
-    vector<int> i_id = this->IOHprofiler_suite_get_instance_id();
-    vector<int> d = this->IOHprofiler_suite_get_dimension();
-    for (int i = 0; i != p_id.size(); ++i)
+    for (size_t i = 0; i != p_id.size(); ++i)
     {
-      for (int j = 0; j != d.size(); ++j)
-      {
-        for (int h = 0; h != i_id.size(); ++h)
-        {
-          shared_ptr<W_Model_OneMax> p(new W_Model_OneMax());
-          p->set_w_setting(this->dummy_para_[this->para_product_[p_id[i] - 1][0]],
-                           this->epistasis_para_[this->para_product_[p_id[i] - 1][1]],
-                           this->neturality_para_[this->para_product_[p_id[i] - 1][2]],
-                           static_cast<int>(floor(this->IOHprofiler_suite_get_dimension()[j] * this->ruggedness_para_[this->para_product_[p_id[i] - 1][3]])));
-
-          // Set the problem name.
-          string problem_name = "Onemax";
-          std::stringstream dss;
-          dss << std::setprecision(3) << this->dummy_para_[this->para_product_[p_id[i] - 1][0]];
-          problem_name += "_D" + dss.str();
-          problem_name += "_E" + std::to_string(this->epistasis_para_[this->para_product_[p_id[i] - 1][1]]);
-          problem_name += "_N" + std::to_string(this->neturality_para_[this->para_product_[p_id[i] - 1][2]]);
-          std::stringstream rss;
-          rss << std::setprecision(3) << this->ruggedness_para_[this->para_product_[p_id[i] - 1][3]];
-          problem_name += "_R" + rss.str();
-          p->IOHprofiler_set_problem_name(problem_name);
-          p->IOHprofiler_set_problem_id(p_id[i]);
-          p->IOHprofiler_set_number_of_variables(d[j]);
-          p->IOHprofiler_set_instance_id(i_id[h]);
-          this->push_back(p);
-          mapIDTOName(p_id[i], problem_name);
-        }
-      }
+      mapIDTOName(p_id[i], this->problem_name(p_id[i]));
     }
+    IOHprofiler_suite<int>::loadProblem();
+  }
 
-    assert(this->IOHprofiler_get_size_of_problem_list() == this->size());
-    this->IOHprofiler_set_get_problem_flag(false);
-    this->IOHprofiler_set_problem_list_index(0);
-    this->IOHprofiler_set_load_problem_flag(true);
+  /// \fn Problem_ptr create_problem(const size_t index)
+  /// \brief Creates the w-model problem at the given index, ordered by problem, dimension and instance.
+  Problem_ptr create_problem(const size_t index)
+  {
+    const size_t instances = this->IOHprofiler_suite_get_number_of_instances();
+    const size_t dimensions = this->IOHprofiler_suite_get_number_of_dimensions();
+    const int p_id = this->IOHprofiler_suite_get_problem_id()[index / instances / dimensions];
+    const int i_id = this->IOHprofiler_suite_get_instance_id()[index % instances];
+    const int d = this->IOHprofiler_suite_get_dimension()[index / instances % dimensions];
+    const vector<size_t> &para = this->para_product_[p_id - 1];
+
+    shared_ptr<W_Model_OneMax> p(new W_Model_OneMax());
+    p->set_w_setting(this->dummy_para_[para[0]],
+                     this->epistasis_para_[para[1]],
+                     this->neturality_para_[para[2]],
+                     static_cast<int>(floor(d * this->ruggedness_para_[para[3]])));
+    p->IOHprofiler_set_problem_name(this->problem_name(p_id));
+    p->IOHprofiler_set_problem_id(p_id);
+    p->IOHprofiler_set_instance_id(i_id);
+    p->IOHprofiler_set_number_of_variables(d);
+    return p;
   }
 
   vector<double> get_dummy_para()
@@ -223,6 +208,23 @@ public:
   }
 
 private:
+  /// \fn string problem_name(const int p_id)
+  /// \brief The name of the problem, composed of its w-model parameters.
+  string problem_name(const int p_id)
+  {
+    const vector<size_t> &para = this->para_product_[p_id - 1];
+    string name = "Onemax";
+    std::stringstream dss;
+    dss << std::setprecision(3) << this->dummy_para_[para[0]];
+    name += "_D" + dss.str();
+    name += "_E" + std::to_string(this->epistasis_para_[para[1]]);
+    name += "_N" + std::to_string(this->neturality_para_[para[2]]);
+    std::stringstream rss;
+    rss << std::setprecision(3) << this->ruggedness_para_[para[3]];
+    name += "_R" + rss.str();
+    return name;
+  }
+
   vector<double> dummy_para_;
   vector<int> epistasis_para_;
   vector<int> neturality_para_;